@@ -5,8 +5,6 @@
 #include "util/tokenize_piece.hh"
 #include "util/utf8.hh"
 
-#define BOOST_LEXICAL_CAST_ASSUME_C_LOCALE
-#include <boost/lexical_cast.hpp>
 #include <boost/unordered_map.hpp>
 
 namespace {
@@ -17,6 +15,17 @@ void SplitLine(util::FilePiece &from, std::vector<StringPiece> &to) {
   }
 }
 
+// Unlike boost::lexical_cast, doesn't copy to a std::string first.
+uint64_t ParseCount(StringPiece str) {
+  UTIL_THROW_IF2(str.empty(), "Expected a count");
+  uint64_t ret = 0;
+  for (const char *i = str.data(); i != str.data() + str.size(); ++i) {
+    UTIL_THROW_IF2(*i < '0' || *i > '9', "Bad count " << str);
+    ret = ret * 10 + (*i - '0');
+  }
+  return ret;
+}
+
 bool SameLine(util::FilePiece &f) {
   while (true) {
     switch(f.peek()) {
@@ -53,13 +62,14 @@ int main(int argc, char *argv[]) {
     for (util::TokenIter<util::SingleCharacter, true> pair(model.ReadLine(), '\t'); pair; ++pair) {
       util::TokenIter<util::SingleCharacter> spaces(*pair, ' ');
       StringPiece word(*spaces);
-      uint64_t count = boost::lexical_cast<uint64_t>(*++spaces);
+      uint64_t count = ParseCount(*++spaces);
       if (count > max_count) {
         max_count = count;
         best_word = word;
       }
-      best[key] = vocab.FindOrInsert(best_word);
     }
+    // Only the best casing is ever output.
+    if (max_count) best[key] = vocab.FindOrInsert(best_word);
   }
 
   std::cerr << "Read model." << std::endl;
@@ -89,10 +99,9 @@ int main(int argc, char *argv[]) {
         target_words[second] = vocab.String(found->second);
       }
     }
-    std::vector<StringPiece>::const_iterator i = target_words.begin();
-    if (i != target_words.end()) out << *i;
-    for (++i; i != target_words.end(); ++i) {
-      out << ' ' << *i;
+    for (std::vector<StringPiece>::const_iterator i = target_words.begin(); i != target_words.end(); ++i) {
+      if (i != target_words.begin()) out << ' ';
+      out << *i;
     }
     out << '\n';
   }
@@ -0,0 +1,186 @@
+#ifndef PREPROCESS_CANONICAL__
+#define PREPROCESS_CANONICAL__
+
+/* Hash a canonical view of a line without materializing it.  Used by the
+ * dedupers so that lines differing only in spacing, ASCII case, digits, or
+ * ASCII punctuation count as duplicates while the original line is output.
+ */
+
+#include "util/fast_hash.hh"
+#include "util/murmur_hash.hh"
+#include "util/spaces.hh"
+#include "util/string_piece.hh"
+
+#include <boost/program_options/options_description.hpp>
+#include <boost/program_options/value_semantic.hpp>
+
+#include <string>
+
+#include <stdint.h>
+#include <string.h>
+
+namespace preprocess {
+
+// Hasher (util::MurmurHasher or util::FastHasher) hashes lines when there are
+// no flags.  With flags, lines are fed through a MurmurHash64A-like stream.
+template <class Hasher> class GenericCanonicalHash {
+  public:
+    enum Flag {
+      // Strip leading and trailing spaces and turn runs of spaces into one.
+      kCollapseSpaces = 1,
+      // A-Z become a-z.  Non-ASCII is untouched.
+      kFoldCase = 2,
+      // Every digit 0-9 becomes 0.
+      kFoldDigits = 4,
+      // Remove ASCII punctuation.
+      kDropPunctuation = 8,
+      kAll = 15
+    };
+
+    explicit GenericCanonicalHash(unsigned flags = 0) : flags_(flags) {
+      for (unsigned i = 0; i < 256; ++i) {
+        map_[i] = static_cast<int16_t>(i);
+        if ((flags & kCollapseSpaces) && util::kSpaces[i]) map_[i] = kSpace;
+      }
+      if (flags & kFoldCase) {
+        for (unsigned i = 'A'; i <= 'Z'; ++i) map_[i] = static_cast<int16_t>(i - 'A' + 'a');
+      }
+      if (flags & kFoldDigits) {
+        for (unsigned i = '1'; i <= '9'; ++i) map_[i] = '0';
+      }
+      if (flags & kDropPunctuation) {
+        const char *punct = "!\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~";
+        for (const char *i = punct; *i; ++i) map_[static_cast<unsigned char>(*i)] = kDrop;
+      }
+    }
+
+    unsigned Flags() const { return flags_; }
+
+    // With no flags this is exactly Hasher.
+    uint64_t operator()(const StringPiece &line, uint64_t seed = 0) const {
+      if (!flags_) return Hasher()(line.data(), line.size(), seed);
+      Stream stream(seed);
+      Feed(line, stream);
+      return stream.Finish();
+    }
+
+    // Append the bytes that operator() hashes to to, for comparing lines
+    // exactly.  With no flags that is the line itself.
+    void AppendCanonical(const StringPiece &line, std::string &to) const {
+      if (!flags_) {
+        to.append(line.data(), line.size());
+        return;
+      }
+      Append append(to);
+      Feed(line, append);
+    }
+
+  private:
+    static const int16_t kDrop = -1;
+    static const int16_t kSpace = -2;
+
+    // Sends the canonical bytes of line to sink.Add.
+    template <class Sink> void Feed(const StringPiece &line, Sink &sink) const {
+      bool pending_space = false;
+      for (const unsigned char *i = reinterpret_cast<const unsigned char*>(line.data()); i != reinterpret_cast<const unsigned char*>(line.data() + line.size()); ++i) {
+        int16_t to = map_[*i];
+        if (to >= 0) {
+          if (pending_space) {
+            sink.Add(' ');
+            pending_space = false;
+          }
+          sink.Add(static_cast<uint8_t>(to));
+        } else if (to == kSpace) {
+          // Leading spaces never become pending.
+          pending_space = sink.Length() != 0;
+        }
+      }
+    }
+
+    class Append {
+      public:
+        explicit Append(std::string &to) : to_(to), begin_(to.size()) {}
+        void Add(uint8_t byte) { to_.push_back(static_cast<char>(byte)); }
+        std::size_t Length() const { return to_.size() - begin_; }
+      private:
+        std::string &to_;
+        const std::size_t begin_;
+    };
+
+    /* MurmurHash64A fed one byte at a time.  The length is mixed in at the end
+     * because it is not known in advance, so values differ from
+     * MurmurHash64A.
+     */
+    class Stream {
+      public:
+        explicit Stream(uint64_t seed) : h_(seed), word_(0), length_(0) {}
+
+        void Add(uint8_t byte) {
+          word_ |= static_cast<uint64_t>(byte) << ((length_ & 7) * 8);
+          if ((++length_ & 7) == 0) {
+            uint64_t k = word_ * kMul;
+            k ^= k >> kShift;
+            k *= kMul;
+            h_ ^= k;
+            h_ *= kMul;
+            word_ = 0;
+          }
+        }
+
+        uint64_t Length() const { return length_; }
+
+        uint64_t Finish() const {
+          uint64_t h = h_;
+          if (length_ & 7) {
+            h ^= word_;
+            h *= kMul;
+          }
+          h ^= length_ * kMul;
+          h *= kMul;
+          h ^= h >> kShift;
+          h *= kMul;
+          h ^= h >> kShift;
+          return h;
+        }
+
+      private:
+        static const uint64_t kMul = 0xc6a4a7935bd1e995ULL;
+        static const int kShift = 47;
+
+        uint64_t h_, word_, length_;
+    };
+
+    unsigned flags_;
+
+    // Byte to emit, or kDrop or kSpace.
+    int16_t map_[256];
+};
+
+typedef GenericCanonicalHash<util::MurmurHasher> CanonicalHash;
+
+// Command line switches shared by the dedupers.
+struct CanonicalOptions {
+  bool collapse_spaces, fold_case, fold_digits, drop_punctuation, all;
+
+  void Add(boost::program_options::options_description &desc) {
+    namespace po = boost::program_options;
+    desc.add_options()
+      ("collapse-spaces", po::bool_switch(&collapse_spaces)->default_value(false), "Ignore leading, trailing, and repeated spaces when comparing lines")
+      ("fold-case", po::bool_switch(&fold_case)->default_value(false), "Ignore ASCII case when comparing lines")
+      ("fold-digits", po::bool_switch(&fold_digits)->default_value(false), "Treat all digits as the same when comparing lines")
+      ("drop-punctuation", po::bool_switch(&drop_punctuation)->default_value(false), "Ignore ASCII punctuation when comparing lines")
+      ("canonical", po::bool_switch(&all)->default_value(false), "All of the above");
+  }
+
+  unsigned Flags() const {
+    if (all) return CanonicalHash::kAll;
+    return (collapse_spaces ? CanonicalHash::kCollapseSpaces : 0) |
+      (fold_case ? CanonicalHash::kFoldCase : 0) |
+      (fold_digits ? CanonicalHash::kFoldDigits : 0) |
+      (drop_punctuation ? CanonicalHash::kDropPunctuation : 0);
+  }
+};
+
+} // namespace preprocess
+
+#endif // PREPROCESS_CANONICAL__
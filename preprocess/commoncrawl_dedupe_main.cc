@@ -3,36 +3,39 @@
 // Removes document delimiter lines (those that begin with df6fa1abb58549287111ba8d776733e9).
 // Removes duplicate lines.
 // Removes any line that contains invalid UTF-8.
+// Optionally removes repeated documents and paragraphs (runs of lines between
+// blank lines) before looking at their lines.
+// Optionally compares lines by a canonical form (see preprocess/canonical.hh).
+// Optionally stores compact fingerprints of lines or grows the table
+// incrementally (see preprocess/key_set.hh).
 //
+#include "preprocess/canonical.hh"
+#include "preprocess/key_set.hh"
 #include "util/fake_ofstream.hh"
 #include "util/file_piece.hh"
 #include "util/murmur_hash.hh"
-#include "util/probing_hash_table.hh"
 #include "util/scoped.hh"
 #include "util/utf8.hh"
 
+#include <boost/program_options/options_description.hpp>
+#include <boost/program_options/parsers.hpp>
+#include <boost/program_options/positional_options.hpp>
+#include <boost/program_options/variables_map.hpp>
+
+#include <algorithm>
 #include <iostream>
+#include <string>
+#include <vector>
 
 #include <stdint.h>
 
 namespace {
 
-// Hash table with 64-bit keys.
-struct Entry {
-  typedef uint64_t Key;
-  uint64_t key;
-  uint64_t GetKey() const { return key; }
-  void SetKey(uint64_t to) { key = to; }
-};
-
-typedef util::AutoProbing<Entry, util::IdentityHash> Table;
+typedef preprocess::KeySet Table;
 
-// Use 64-bit MurmurHash in the hash table.  
-bool IsNewLine(Table &table, StringPiece l) {
-  Table::MutableIterator it;
-  Entry entry;
-  entry.key = util::MurmurHashNative(l.data(), l.size(), 1);
-  return !table.FindOrInsert(entry, it);
+// Use 64-bit MurmurHash (of the canonical form, if requested) in the hash table.
+bool IsNewLine(Table &table, const preprocess::CanonicalHash &hash, StringPiece l) {
+  return !table.FindOrInsert(hash(l, 1));
 }
 
 // Remove leading and trailing space characters.
@@ -46,23 +49,147 @@ StringPiece StripSpaces(StringPiece ret) {
   return ret;
 }
 
+// Seeds for the rolling hashes of documents and paragraphs, which share the
+// table with lines (seeded with 1).
+const uint64_t kDocumentSeed = 2;
+const uint64_t kParagraphSeed = 3;
+
+// Lines hashed and prefetched ahead of their lookups.
+const std::size_t kBatch = 64;
+
+/* Buffers the lines of one document so that a repeated document or paragraph
+ * can be dropped as a whole.  Any line of a repeated block has been seen, so
+ * the output is the same as deduplicating lines alone, but the lines of
+ * repeated blocks skip the UTF-8 check and their own table lookups.  Without
+ * documents or paragraphs, this just batches lines to prefetch their lookups.
+ */
+class BlockDedupe {
+  public:
+    BlockDedupe(Table &table, const preprocess::CanonicalHash &hash, bool documents, bool paragraphs, util::FakeOFStream &out)
+      : table_(table), hash_(hash), documents_(documents), paragraphs_(paragraphs), out_(out) {}
+
+    void Add(StringPiece line) {
+      text_.append(line.data(), line.size());
+      ends_.push_back(text_.size());
+      // Without blocks, lines are independent so keep the buffer small.
+      if (!documents_ && !paragraphs_ && ends_.size() == kBatch) Flush();
+    }
+
+    // Process and clear the buffered document.
+    void Flush() {
+      if (!documents_ || ends_.size() < 2 || IsNewBlock(0, ends_.size(), kDocumentSeed)) {
+        if (paragraphs_) {
+          FlushParagraphs();
+        } else {
+          Lines(0, ends_.size());
+        }
+      }
+      text_.clear();
+      ends_.clear();
+    }
+
+  private:
+    StringPiece Line(std::size_t i) const {
+      std::size_t begin = i ? ends_[i - 1] : 0;
+      return StringPiece(text_.data() + begin, ends_[i] - begin);
+    }
+
+    bool IsNewBlock(std::size_t begin, std::size_t end, uint64_t seed) {
+      uint64_t rolling = seed;
+      for (std::size_t i = begin; i < end; ++i) {
+        rolling = hash_(Line(i), rolling);
+      }
+      return !table_.FindOrInsert(rolling);
+    }
+
+    void FlushParagraphs() {
+      std::size_t begin = 0;
+      while (begin < ends_.size()) {
+        std::size_t end = begin;
+        while (end < ends_.size() && !Line(end).empty()) ++end;
+        if (end - begin < 2 || IsNewBlock(begin, end, kParagraphSeed)) {
+          Lines(begin, end);
+        }
+        // Blank line ending the paragraph.
+        if (end < ends_.size()) Lines(end, end + 1);
+        begin = end + 1;
+      }
+    }
+
+    void Lines(std::size_t begin, std::size_t end) {
+      // Hash and prefetch a batch of lines before looking any of them up.
+      uint64_t keys[kBatch];
+      for (; begin < end; begin += kBatch) {
+        std::size_t count = std::min(kBatch, end - begin);
+        for (std::size_t i = 0; i < count; ++i) {
+          keys[i] = hash_(Line(begin + i), 1);
+          table_.Prefetch(keys[i]);
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+          StringPiece l(Line(begin + i));
+          // A line passes if:
+          // It does not begin with the magic document delimiter (not buffered).
+          // Its 64-bit hash has not been seen before.
+          // and it is valid UTF-8.
+          if (!table_.FindOrInsert(keys[i]) && utf8::IsUTF8(l)) {
+            out_ << l << '\n';
+          }
+        }
+      }
+    }
+
+    Table &table_;
+    const preprocess::CanonicalHash &hash_;
+    const bool documents_, paragraphs_;
+    util::FakeOFStream &out_;
+
+    // Stripped lines of the current document and where each ends.
+    std::string text_;
+    std::vector<std::size_t> ends_;
+};
 
 } // namespace
 
 int main(int argc, char *argv[]) {
-  if (argc > 2 || (argc == 2 && (!strcmp("-h", argv[1]) || !strcmp("--help", argv[1])))) {
-    std::cerr << "Usage: " << argv[0] << " file_to_remove\nLines that appear in file_to_remove will be excluded from the output.\n" << std::endl;
+  namespace po = boost::program_options;
+  preprocess::CanonicalOptions canonical;
+  bool help, documents, paragraphs;
+  preprocess::KeySetOptions set_options;
+  std::string remove_file;
+  po::options_description desc("Options");
+  desc.add_options()
+    ("help,h", po::bool_switch(&help)->default_value(false), "Show this help")
+    ("documents", po::bool_switch(&documents)->default_value(false), "Drop documents that were seen before as a whole")
+    ("paragraphs", po::bool_switch(&paragraphs)->default_value(false), "Drop paragraphs (runs of lines between blank lines) that were seen before as a whole");
+  canonical.Add(desc);
+  set_options.Add(desc);
+  po::options_description hidden;
+  hidden.add_options()("file_to_remove", po::value(&remove_file));
+  po::options_description all;
+  all.add(desc).add(hidden);
+  po::positional_options_description positional;
+  positional.add("file_to_remove", 1);
+  po::variables_map vm;
+  try {
+    po::store(po::command_line_parser(argc, argv).options(all).positional(positional).run(), vm);
+    po::notify(vm);
+  } catch (const po::error &e) {
+    help = true;
+  }
+  if (help) {
+    std::cerr << "Usage: " << argv[0] << " [options] [file_to_remove]\nLines that appear in file_to_remove will be excluded from the output.\n" << desc << std::endl;
     return 1;
   }
   try {
-    Table table;
+    Table table(set_options);
     StringPiece l;
+    preprocess::CanonicalHash hash(canonical.Flags());
 
     // If there's a file to remove lines from, add it to the hash table of lines.
-    if (argc == 2) {
-      util::FilePiece removing(argv[1]);
+    if (!remove_file.empty()) {
+      util::FilePiece removing(remove_file.c_str());
       while (removing.ReadLineOrEOF(l)) {
-        IsNewLine(table, StripSpaces(l));
+        IsNewLine(table, hash, StripSpaces(l));
       }
     }
 
@@ -70,16 +197,16 @@ int main(int argc, char *argv[]) {
     const StringPiece remove_line("df6fa1abb58549287111ba8d776733e9");
     util::FakeOFStream out(1);
     util::FilePiece in(0, "stdin", &std::cerr);
+    BlockDedupe blocks(table, hash, documents, paragraphs, out);
     while (in.ReadLineOrEOF(l)) {
       l = StripSpaces(l);
-      // A line passes if:
-      // It does not begin with the magic document delimiter.
-      // Its 64-bit hash has not been seen before.
-      // and it is valid UTF-8.
-      if (!starts_with(l, remove_line) && IsNewLine(table, l) && utf8::IsUTF8(l)) {
-        out << l << '\n';
+      if (starts_with(l, remove_line)) {
+        blocks.Flush();
+      } else {
+        blocks.Add(l);
       }
     }
+    blocks.Flush();
   } 
   catch (const std::exception &e) {
     std::cerr << e.what() << std::endl;
@@ -1,36 +1,597 @@
+#include "preprocess/canonical.hh"
+#include "preprocess/key_set.hh"
 #include "preprocess/parallel.hh"
-#include "util/murmur_hash.hh"
-#include "util/probing_hash_table.hh"
+#include "util/fake_ofstream.hh"
+#include "util/file.hh"
+#include "util/file_piece.hh"
+#include "util/fixed_array.hh"
 #include "util/scoped.hh"
 
-#include <boost/lexical_cast.hpp>
+#include <boost/bind.hpp>
 
+#include <boost/program_options/options_description.hpp>
+#include <boost/program_options/parsers.hpp>
+#include <boost/program_options/positional_options.hpp>
+#include <boost/program_options/variables_map.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <stdint.h>
+#include <string.h>
+
+// What identifies a pair of parallel lines as a duplicate.
+enum PairKey {
+  // Either side was seen before, on either side of any pair.
+  kPairEach,
+  // The same pair was seen before.
+  kPairBoth,
+  // The same source line was seen before.
+  kPairSource,
+  // The same target line was seen before.
+  kPairTarget
+};
+
+// Computes the table key of a line or a pair of lines.
+template <class Hash> class Keyer {
+  public:
+    Keyer(const Hash &hash, PairKey pair_key) : hash_(hash), pair_key_(pair_key) {}
+
+    PairKey GetPairKey() const { return pair_key_; }
+
+    // 0 is the invalid key in KeySet.
+    uint64_t operator()(const StringPiece &line) const {
+      return hash_(line) + 1;
+    }
+
+    // Not for kPairEach which inserts both sides separately.
+    uint64_t operator()(const StringPiece &line0, const StringPiece &line1) const {
+      switch (pair_key_) {
+        case kPairSource:
+          return (*this)(line0);
+        case kPairTarget:
+          return (*this)(line1);
+        default:
+          return hash_(line1, hash_(line0)) + 1;
+      }
+    }
+
+    // What the key of a line hashes, to compare lines exactly.  A view of
+    // line itself or of buffer.
+    StringPiece Text(const StringPiece &line, std::string &buffer) const {
+      if (!hash_.Flags()) return line;
+      buffer.clear();
+      hash_.AppendCanonical(line, buffer);
+      return buffer;
+    }
+
+    // Not for kPairEach.  Both sides are joined with a newline, which can't
+    // be in a line.
+    StringPiece Text(const StringPiece &line0, const StringPiece &line1, std::string &buffer) const {
+      switch (pair_key_) {
+        case kPairSource:
+          return Text(line0, buffer);
+        case kPairTarget:
+          return Text(line1, buffer);
+        default:
+          buffer.clear();
+          hash_.AppendCanonical(line0, buffer);
+          buffer.push_back('\n');
+          hash_.AppendCanonical(line1, buffer);
+          return buffer;
+      }
+    }
+
+  private:
+    const Hash &hash_;
+
+    const PairKey pair_key_;
+};
+
+// Batch pass for FilterParallelBatch: all keys of a batch are hashed and
+// prefetched before any is looked up.
+template <class KeyerT> class Dedupe {
+  public:
+    Dedupe(const KeyerT &keyer, const preprocess::KeySetOptions &set_options) : keyer_(keyer), set_(set_options) {}
+
+    void operator()(const StringPiece *lines, std::size_t count, bool *keep) {
+      for (std::size_t i = 0; i < count; ++i) keys_[i] = keyer_(lines[i]);
+      set_.FindOrInsertBatch(keys_, count, keep);
+      for (std::size_t i = 0; i < count; ++i) keep[i] = !keep[i];
+    }
+
+    void operator()(const StringPiece *lines0, const StringPiece *lines1, std::size_t count, bool *keep) {
+      if (keyer_.GetPairKey() != kPairEach) {
+        for (std::size_t i = 0; i < count; ++i) keys_[i] = keyer_(lines0[i], lines1[i]);
+        set_.FindOrInsertBatch(keys_, count, keep);
+        for (std::size_t i = 0; i < count; ++i) keep[i] = !keep[i];
+        return;
+      }
+      // The target side is only inserted if the source side is new.
+      for (std::size_t i = 0; i < count; ++i) {
+        keys_[2 * i] = keyer_(lines0[i]);
+        keys_[2 * i + 1] = keyer_(lines1[i]);
+      }
+      for (std::size_t i = 0; i < 2 * count; ++i) set_.Prefetch(keys_[i]);
+      for (std::size_t i = 0; i < count; ++i) {
+        keep[i] = IsNew(keys_[2 * i]) && IsNew(keys_[2 * i + 1]);
+      }
+    }
+
+  private:
+    bool IsNew(uint64_t key) {
+      return !set_.FindOrInsert(key);
+    }
+
+    const KeyerT &keyer_;
+
+    preprocess::KeySet set_;
 
-struct Entry {
-  typedef uint64_t Key;
-  uint64_t key;
-  uint64_t GetKey() const { return key; }
-  void SetKey(uint64_t to) { key = to; }
+    uint64_t keys_[2 * kFilterBatch];
 };
 
-class Dedupe {
+/* Like Dedupe but confirms every hash match by comparing the text.  Keys are
+ * probed as a batch, then the text of matching entries is prefetched, so both
+ * cache misses overlap across the batch.
+ */
+template <class KeyerT> class ExactDedupe {
   public:
-    bool operator()(const StringPiece &line) {
-      Entry entry;
-      entry.key = util::MurmurHashNative(line.data(), line.size()) + 1;
-      Table::MutableIterator it;
-      return !table_.FindOrInsert(entry, it);
+    ExactDedupe(const KeyerT &keyer, const preprocess::KeySetOptions &set_options) : keyer_(keyer), set_(set_options) {}
+
+    void operator()(const StringPiece *lines, std::size_t count, bool *keep) {
+      for (std::size_t i = 0; i < count; ++i) {
+        keys_[i] = keyer_(lines[i]);
+        texts_[i] = keyer_.Text(lines[i], buffers_[i]);
+      }
+      set_.FindOrInsertBatch(keys_, texts_, count, keep);
+      for (std::size_t i = 0; i < count; ++i) keep[i] = !keep[i];
+    }
+
+    void operator()(const StringPiece *lines0, const StringPiece *lines1, std::size_t count, bool *keep) {
+      if (keyer_.GetPairKey() != kPairEach) {
+        for (std::size_t i = 0; i < count; ++i) {
+          keys_[i] = keyer_(lines0[i], lines1[i]);
+          texts_[i] = keyer_.Text(lines0[i], lines1[i], buffers_[i]);
+        }
+        set_.FindOrInsertBatch(keys_, texts_, count, keep);
+        for (std::size_t i = 0; i < count; ++i) keep[i] = !keep[i];
+        return;
+      }
+      for (std::size_t i = 0; i < count; ++i) {
+        keys_[2 * i] = keyer_(lines0[i]);
+        keys_[2 * i + 1] = keyer_(lines1[i]);
+        set_.Prefetch(keys_[2 * i]);
+        set_.Prefetch(keys_[2 * i + 1]);
+      }
+      // The target side is only inserted if the source side is new.
+      for (std::size_t i = 0; i < count; ++i) {
+        keep[i] = !set_.FindOrInsert(keys_[2 * i], keyer_.Text(lines0[i], buffers_[0])) &&
+          !set_.FindOrInsert(keys_[2 * i + 1], keyer_.Text(lines1[i], buffers_[0]));
+      }
     }
 
+    uint64_t Collisions() const { return set_.Collisions(); }
+
+  private:
+    const KeyerT &keyer_;
+
+    preprocess::ExactKeySet set_;
+
+    uint64_t keys_[2 * kFilterBatch];
+
+    // Text of each line in a batch, in buffers_ when canonicalized.
+    StringPiece texts_[kFilterBatch];
+    std::string buffers_[kFilterBatch];
+};
+
+// Worker for ProcessBatchesInOrder that turns lines into their keys, as raw
+// bytes in input order.  With pairs, the lines are pairs one after the other.
+template <class KeyerT> class KeyWorker {
+  public:
+    KeyWorker(const KeyerT &keyer, bool pairs) : keyer_(keyer), pairs_(pairs) {}
+
+    void operator()(const StringPiece *lines, std::size_t count, std::string &out) {
+      uint64_t key;
+      for (const StringPiece *i = lines; i < lines + count; ++i) {
+        if (pairs_) {
+          key = keyer_(i[0], i[1]);
+          ++i;
+        } else {
+          key = keyer_(*i);
+        }
+        out.append(reinterpret_cast<const char*>(&key), sizeof(key));
+      }
+    }
+
+  private:
+    const KeyerT &keyer_;
+    const bool pairs_;
+};
+
+// Reads stdin for ProcessBatchesInOrder, copying the lines to spool if it is
+// set so they can be read again.
+class SpoolBatchReader {
+  public:
+    SpoolBatchReader(util::FilePiece &in, util::FakeOFStream *spool) : in_(in), spool_(spool) {}
+
+    bool operator()(LineBatch &batch) {
+      if (!ReadBatch(in_, batch, true)) return false;
+      if (spool_) {
+        const StringPiece *lines = batch.Lines();
+        for (std::size_t i = 0; i < batch.Size(); ++i) {
+          *spool_ << lines[i] << '\n';
+        }
+      }
+      return true;
+    }
+
+  private:
+    util::FilePiece &in_;
+    util::FakeOFStream *spool_;
+};
+
+// Reads parallel files for ProcessBatchesInOrder, each pair as two lines in a
+// row of the batch.  Stops early, rather than throwing from under the
+// workers, if the second file is shorter.
+class PairBatchReader {
+  public:
+    PairBatchReader(util::FilePiece &in0, util::FilePiece &in1) : in0_(in0), in1_(in1), short_(false) {}
+
+    bool operator()(LineBatch &batch) {
+      batch.Clear();
+      std::size_t bytes = 0;
+      StringPiece line;
+      while (bytes < kOrderedBatchBytes && in0_.ReadLineOrEOF(line)) {
+        batch.Add(line);
+        bytes += line.size() + 1;
+        if (!in1_.ReadLineOrEOF(line)) {
+          short_ = true;
+          batch.Clear();
+          return false;
+        }
+        batch.Add(line);
+        bytes += line.size() + 1;
+      }
+      return batch.Size();
+    }
+
+    // The second file ran out first.
+    bool Short() const { return short_; }
+
   private:
-    typedef util::AutoProbing<Entry, util::IdentityHash> Table;
-    Table table_;
+    util::FilePiece &in0_, &in1_;
+    bool short_;
 };
 
+// Buffered binary file of fixed-size records, written then read once.
+template <class Record> class RecordFile {
+  public:
+    static const std::size_t kBuffer = 4096;
+
+    RecordFile() : file_(util::MakeTemp(util::DefaultTempDirectory())), offset_(0) {}
+
+    void Write(const Record &record) {
+      buffer_.push_back(record);
+      if (buffer_.size() == kBuffer) Flush();
+    }
+
+    // Call once, between writing and reading.
+    void Rewind() {
+      Flush();
+      util::SeekOrThrow(file_.get(), 0);
+      std::vector<Record>().swap(buffer_);
+    }
+
+    // Returns false at the end of the file.
+    bool Read(Record &record) {
+      if (offset_ == buffer_.size()) {
+        buffer_.resize(kBuffer);
+        std::size_t got = util::ReadOrEOF(file_.get(), &buffer_[0], kBuffer * sizeof(Record));
+        buffer_.resize(got / sizeof(Record));
+        offset_ = 0;
+        if (buffer_.empty()) return false;
+      }
+      record = buffer_[offset_++];
+      return true;
+    }
+
+  private:
+    void Flush() {
+      if (!buffer_.empty()) util::WriteOrThrow(file_.get(), &buffer_[0], buffer_.size() * sizeof(Record));
+      buffer_.clear();
+    }
+
+    util::scoped_fd file_;
+    std::vector<Record> buffer_;
+    std::size_t offset_;
+};
+
+/* Dedupe with the keys partitioned into shards, each deduplicated on its own
+ * thread with its own table.  Keys are hashed by worker threads and handed
+ * over in input order, and each shard's (key, line number) records are
+ * spilled to a temporary file, so memory holds only the tables, which grow
+ * with the unique lines of a shard.  Each shard writes the numbers of the
+ * lines it keeps to another file, in input order, and Keep merges them.  The
+ * first occurrence of each key is kept exactly as in the single-threaded path.
+ */
+class ShardedDedupe {
+  public:
+    ShardedDedupe(std::size_t shards, const preprocess::KeySetOptions &set_options)
+      : spills_(shards), kept_(shards), count_(0), set_options_(set_options) {
+      for (std::size_t i = 0; i < shards; ++i) {
+        spills_.push_back();
+        kept_.push_back();
+      }
+    }
+
+    // Sink for ProcessBatchesInOrder: the keys from KeyWorker.
+    void operator()(const std::string &keys) {
+      uint64_t key;
+      for (const char *i = keys.data(); i != keys.data() + keys.size(); i += sizeof(key)) {
+        memcpy(&key, i, sizeof(key));
+        Add(key);
+      }
+    }
+
+    void Run(std::size_t threads) {
+      boost::thread_group pool;
+      for (std::size_t t = 0; t < threads; ++t) {
+        pool.create_thread(boost::bind(&ShardedDedupe::Work, this, t, threads));
+      }
+      pool.join_all();
+      for (std::size_t shard = 0; shard < kept_.size(); ++shard) {
+        kept_[shard].Rewind();
+        uint64_t line;
+        if (kept_[shard].Read(line)) next_.push(std::make_pair(line, shard));
+      }
+    }
+
+    uint64_t Count() const { return count_; }
+
+    // Call after Run with each line number in order.
+    bool Keep(uint64_t line) {
+      if (next_.empty() || next_.top().first != line) return false;
+      std::size_t shard = next_.top().second;
+      next_.pop();
+      uint64_t following;
+      if (kept_[shard].Read(following)) next_.push(std::make_pair(following, shard));
+      return true;
+    }
+
+  private:
+    struct Record {
+      uint64_t key, line;
+    };
+
+    void Add(uint64_t key) {
+      // The full table uses the low bits of the key and the compact one the
+      // high bits, so the shard is the middle bits of the key times a
+      // multiplicative hash constant, modulo the number of shards.
+      std::size_t shard = ((key * 0x9E3779B97F4A7C15ULL) >> 32) % spills_.size();
+      Record record;
+      record.key = key;
+      record.line = count_++;
+      spills_[shard].Write(record);
+    }
+
+    void Work(std::size_t begin, std::size_t stride) {
+      for (std::size_t shard = begin; shard < spills_.size(); shard += stride) {
+        RecordFile<Record> &spill = spills_[shard];
+        spill.Rewind();
+        preprocess::KeySet set(set_options_, set_options_.expected / spills_.size());
+        uint64_t keys[kFilterBatch], lines[kFilterBatch];
+        bool found[kFilterBatch];
+        Record record;
+        for (bool more = true; more;) {
+          std::size_t count = 0;
+          while (count < kFilterBatch && (more = spill.Read(record))) {
+            keys[count] = record.key;
+            lines[count++] = record.line;
+          }
+          set.FindOrInsertBatch(keys, count, found);
+          for (std::size_t i = 0; i < count; ++i) {
+            if (!found[i]) kept_[shard].Write(lines[i]);
+          }
+        }
+      }
+    }
+
+    // Spills are written by the sink's thread, then each shard's files are
+    // used by one worker, then kept_ is read by Keep.
+    util::FixedArray<RecordFile<Record> > spills_;
+    util::FixedArray<RecordFile<uint64_t> > kept_;
+
+    // Next kept line of each shard, smallest first.
+    std::priority_queue<std::pair<uint64_t, std::size_t>, std::vector<std::pair<uint64_t, std::size_t> >, std::greater<std::pair<uint64_t, std::size_t> > > next_;
+
+    uint64_t count_;
+
+    const preprocess::KeySetOptions &set_options_;
+};
+
+void PrintKept(uint64_t output, uint64_t input) {
+  std::cerr << "Kept " << output << " / " << input << " = " << (static_cast<float>(output) / static_cast<float>(input)) << std::endl;
+}
+
+// Keys are collected on the first pass; lines are read again for output.
+template <class KeyerT> int ShardedSingle(const KeyerT &keyer, ShardedDedupe &sharded, std::size_t threads, std::size_t shard_threads) {
+  // Input that can't be read twice is spooled to a temporary file.
+  bool seekable = util::SizeFile(0) != util::kBadSize;
+  util::scoped_fd spool;
+  {
+    std::vector<KeyWorker<KeyerT> > workers(threads, KeyWorker<KeyerT>(keyer, false));
+    std::vector<KeyWorker<KeyerT>*> pointers;
+    for (std::size_t t = 0; t < threads; ++t) pointers.push_back(&workers[t]);
+    util::FilePiece in(util::DupOrThrow(0), "stdin", &std::cerr);
+    boost::scoped_ptr<util::FakeOFStream> spool_out;
+    if (!seekable) {
+      spool.reset(util::MakeTemp(util::DefaultTempDirectory()));
+      spool_out.reset(new util::FakeOFStream(spool.get()));
+    }
+    SpoolBatchReader read(in, spool_out.get());
+    ProcessBatchesInOrder(read, &pointers[0], threads, sharded);
+  }
+  sharded.Run(shard_threads);
+  int reread = seekable ? 0 : spool.release();
+  util::SeekOrThrow(reread, 0);
+  util::FilePiece in(reread);
+  util::FakeOFStream out(1);
+  uint64_t output = 0;
+  StringPiece line;
+  for (uint64_t i = 0; in.ReadLineOrEOF(line); ++i) {
+    if (sharded.Keep(i)) {
+      out << line << '\n';
+      ++output;
+    }
+  }
+  PrintKept(output, sharded.Count());
+  return 0;
+}
+
+template <class KeyerT> int ShardedParallel(const KeyerT &keyer, ShardedDedupe &sharded, std::size_t threads, std::size_t shard_threads, const std::vector<std::string> &files) {
+  StringPiece line0, line1;
+  {
+    std::vector<KeyWorker<KeyerT> > workers(threads, KeyWorker<KeyerT>(keyer, true));
+    std::vector<KeyWorker<KeyerT>*> pointers;
+    for (std::size_t t = 0; t < threads; ++t) pointers.push_back(&workers[t]);
+    util::FilePiece in0(files[0].c_str(), &std::cerr), in1(files[1].c_str());
+    PairBatchReader read(in0, in1);
+    ProcessBatchesInOrder(read, &pointers[0], threads, sharded);
+    if (read.Short()) {
+      std::cerr << "Input is not balaced: " << files[1] << " is shorter than " << files[0] << std::endl;
+      return 2;
+    }
+    if (in1.ReadLineOrEOF(line1)) {
+      std::cerr << "Input is not balaced: " << files[1] << " has " << line1 << std::endl;
+      return 2;
+    }
+  }
+  sharded.Run(shard_threads);
+  util::FilePiece in0(files[0].c_str()), in1(files[1].c_str());
+  util::FakeOFStream out0(util::CreateOrThrow(files[2].c_str())), out1(util::CreateOrThrow(files[3].c_str()));
+  uint64_t output = 0;
+  for (uint64_t i = 0; in0.ReadLineOrEOF(line0); ++i) {
+    line1 = in1.ReadLine();
+    if (sharded.Keep(i)) {
+      out0 << line0 << '\n';
+      out1 << line1 << '\n';
+      ++output;
+    }
+  }
+  PrintKept(output, sharded.Count());
+  return 0;
+}
+
+template <class Hasher> int Run(unsigned flags, PairKey pair_key, std::size_t shards, std::size_t threads, bool exact, const preprocess::KeySetOptions &set_options, std::vector<std::string> &files, char *argv0) {
+  typedef preprocess::GenericCanonicalHash<Hasher> Hash;
+  Hash hash(flags);
+  Keyer<Hash> keyer(hash, pair_key);
+
+  if (shards > 1) {
+    if (!threads) threads = shards;
+    if (pair_key == kPairEach && !files.empty()) {
+      std::cerr << "--shards needs a --pair-key other than each" << std::endl;
+      return 1;
+    }
+    ShardedDedupe sharded(shards, set_options);
+    try {
+      if (files.empty()) {
+        return ShardedSingle(keyer, sharded, threads, std::min(threads, shards));
+      } else if (files.size() == 4) {
+        return ShardedParallel(keyer, sharded, threads, std::min(threads, shards), files);
+      }
+    } catch (const std::exception &e) {
+      std::cerr << e.what() << std::endl;
+      return 1;
+    }
+  }
+
+  // Hand FilterParallelBatch the same argument shape FilterParallel always had.
+  std::vector<char*> args;
+  args.push_back(argv0);
+  for (std::vector<std::string>::iterator i = files.begin(); i != files.end(); ++i) {
+    args.push_back(&(*i)[0]);
+  }
+  args.push_back(NULL);
+
+  if (exact) {
+    ExactDedupe<Keyer<Hash> > dedupe(keyer, set_options);
+    int ret = FilterParallelBatch(dedupe, static_cast<int>(args.size() - 1), &args[0]);
+    std::cerr << "Hash collisions between distinct lines: " << dedupe.Collisions() << std::endl;
+    return ret;
+  }
+  Dedupe<Keyer<Hash> > dedupe(keyer, set_options);
+  return FilterParallelBatch(dedupe, static_cast<int>(args.size() - 1), &args[0]);
+}
+
 int main(int argc, char *argv[]) {
-  Dedupe dedupe;
-  return FilterParallel(dedupe, argc, argv);
+  namespace po = boost::program_options;
+  preprocess::CanonicalOptions canonical;
+  std::vector<std::string> files;
+  std::string pair_key_name, hash_name;
+  std::size_t shards, threads;
+  bool exact;
+  preprocess::KeySetOptions set_options;
+  po::options_description desc("Deduplication options");
+  desc.add_options()
+    ("shards", po::value(&shards)->default_value(1), "Split the hash table into this many shards, each deduplicated by a thread.  Output is the same as with one shard.")
+    ("threads", po::value(&threads)->default_value(0), "Threads to use with --shards.  Default: the number of shards")
+    ("pair-key", po::value(&pair_key_name)->default_value("each"), "For parallel files, what counts as a duplicate pair: each (either side seen anywhere), pair (the same pair), source, or target")
+    ("hash", po::value(&hash_name)->default_value("murmur"), "Line hash: murmur (the values older versions used) or fast (util::FastHash, quicker on long lines)")
+    ("exact", po::bool_switch(&exact)->default_value(false), "Keep the text of unique lines and compare it when hashes match, so a hash collision never drops a line.  Takes memory for the text.  Not with --compact or --shards; --group and --incremental are ignored.");
+  canonical.Add(desc);
+  set_options.Add(desc);
+  po::options_description hidden;
+  hidden.add_options()("file", po::value(&files)->composing());
+  po::options_description all;
+  all.add(desc).add(hidden);
+  po::positional_options_description positional;
+  positional.add("file", -1);
+  po::variables_map vm;
+  try {
+    po::store(po::command_line_parser(argc, argv).options(all).positional(positional).run(), vm);
+    po::notify(vm);
+  } catch (const po::error &e) {
+    std::cerr << e.what() << '\n' << desc << std::endl;
+    return 1;
+  }
+
+  PairKey pair_key;
+  if (pair_key_name == "each") {
+    pair_key = kPairEach;
+  } else if (pair_key_name == "pair") {
+    pair_key = kPairBoth;
+  } else if (pair_key_name == "source") {
+    pair_key = kPairSource;
+  } else if (pair_key_name == "target") {
+    pair_key = kPairTarget;
+  } else {
+    std::cerr << "Unknown --pair-key " << pair_key_name << '\n' << desc << std::endl;
+    return 1;
+  }
+
+  if (set_options.fingerprint_bits && (set_options.fingerprint_bits < 40 || set_options.fingerprint_bits > 56)) {
+    std::cerr << "--compact takes 40 to 56 bits" << std::endl;
+    return 1;
+  }
+
+  if (exact && (set_options.fingerprint_bits || shards > 1)) {
+    std::cerr << "--exact does not work with --compact or --shards" << std::endl;
+    return 1;
+  }
+
+  if (hash_name == "murmur") {
+    return Run<util::MurmurHasher>(canonical.Flags(), pair_key, shards, threads, exact, set_options, files, argv[0]);
+  } else if (hash_name == "fast") {
+    return Run<util::FastHasher>(canonical.Flags(), pair_key, shards, threads, exact, set_options, files, argv[0]);
+  }
+  std::cerr << "Unknown --hash " << hash_name << '\n' << desc << std::endl;
+  return 1;
 }
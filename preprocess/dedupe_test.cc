@@ -0,0 +1,93 @@
+// Runs bin/dedupe, whose path is the argument, and checks that sharding
+// doesn't change the output.
+#include "util/file.hh"
+#include "util/scoped.hh"
+
+#define BOOST_TEST_MODULE DedupeTest
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <stdlib.h>
+#include <unistd.h>
+
+namespace {
+
+std::string DedupeLocation() {
+  if (boost::unit_test::framework::master_test_suite().argc < 2) {
+    return "dedupe";
+  }
+  return boost::unit_test::framework::master_test_suite().argv[1];
+}
+
+// Returns the name of a new file in the current directory.
+std::string WriteTemp(const std::string &contents) {
+  char name[] = "tempXXXXXX";
+  util::scoped_fd file(mkstemp(name));
+  BOOST_REQUIRE(file.get() != -1);
+  util::WriteOrThrow(file.get(), contents.data(), contents.size());
+  return name;
+}
+
+std::string ReadAndRemove(const std::string &name) {
+  std::stringstream ret;
+  {
+    std::ifstream in(name.c_str());
+    ret << in.rdbuf();
+  }
+  BOOST_CHECK_EQUAL(0, unlink(name.c_str()));
+  return ret.str();
+}
+
+// Dedupes input from stdin.
+std::string DedupeSingle(const std::string &options, const std::string &input) {
+  std::string in(WriteTemp(input)), out(WriteTemp(""));
+  std::string command(DedupeLocation() + " " + options + " <\"" + in + "\" >\"" + out + "\" 2>/dev/null");
+  BOOST_REQUIRE_EQUAL(0, system(command.c_str()));
+  BOOST_CHECK_EQUAL(0, unlink(in.c_str()));
+  return ReadAndRemove(out);
+}
+
+// Dedupes parallel files and returns both outputs, one after the other.
+std::string DedupeParallel(const std::string &options, const std::string &input0, const std::string &input1) {
+  std::string in0(WriteTemp(input0)), in1(WriteTemp(input1)), out0(WriteTemp("")), out1(WriteTemp(""));
+  std::string command(DedupeLocation() + " " + options + " \"" + in0 + "\" \"" + in1 + "\" \"" + out0 + "\" \"" + out1 + "\" 2>/dev/null");
+  BOOST_REQUIRE_EQUAL(0, system(command.c_str()));
+  BOOST_CHECK_EQUAL(0, unlink(in0.c_str()));
+  BOOST_CHECK_EQUAL(0, unlink(in1.c_str()));
+  std::string ret(ReadAndRemove(out0));
+  return ret + ReadAndRemove(out1);
+}
+
+// Lines repeat, sometimes with a carriage return and sometimes without.
+std::string CRLFLines(unsigned seed) {
+  std::string ret;
+  for (unsigned i = 0; i < 2000; ++i) {
+    std::stringstream line;
+    line << "line " << (i * seed) % 137;
+    ret += line.str();
+    if (i % 3) ret += '\r';
+    ret += '\n';
+  }
+  return ret;
+}
+
+BOOST_AUTO_TEST_CASE(SingleCRLF) {
+  BOOST_CHECK_EQUAL("a\nb\nc\n", DedupeSingle("", "a\r\na\nb\r\nb\nc\n"));
+  BOOST_CHECK_EQUAL("a\nb\nc\n", DedupeSingle("--shards 2", "a\r\na\nb\r\nb\nc\n"));
+  std::string input(CRLFLines(7));
+  std::string unsharded(DedupeSingle("", input));
+  BOOST_CHECK_EQUAL(unsharded, DedupeSingle("--shards 2", input));
+  BOOST_CHECK_EQUAL(unsharded, DedupeSingle("--shards 4 --threads 3", input));
+}
+
+BOOST_AUTO_TEST_CASE(ParallelCRLF) {
+  std::string input0(CRLFLines(7)), input1(CRLFLines(11));
+  std::string unsharded(DedupeParallel("--pair-key pair", input0, input1));
+  BOOST_CHECK_EQUAL(unsharded, DedupeParallel("--pair-key pair --shards 2", input0, input1));
+  BOOST_CHECK_EQUAL(unsharded, DedupeParallel("--pair-key pair --shards 4 --threads 3", input0, input1));
+}
+
+} // namespace
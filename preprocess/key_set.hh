@@ -0,0 +1,251 @@
+#ifndef PREPROCESS_KEY_SET__
+#define PREPROCESS_KEY_SET__
+
+/* Set of 64-bit line hashes for the dedupers.  By default it stores full keys
+ * in util::AutoProbing.  With fingerprint bits it uses util::FingerprintSet,
+ * which takes about half the memory but treats hashes that agree in their top
+ * bits as the same.  With incremental it uses util::IncrementalProbing, which
+ * grows without pausing the stream.  With group it uses util::AutoGroupProbing.
+ */
+
+#include "util/fingerprint_set.hh"
+#include "util/group_probing_hash_table.hh"
+#include "util/pool.hh"
+#include "util/probing_hash_table.hh"
+#include "util/string_piece.hh"
+
+#include <boost/program_options/options_description.hpp>
+#include <boost/program_options/value_semantic.hpp>
+#include <boost/scoped_ptr.hpp>
+
+#include <cstddef>
+#include <vector>
+
+#include <stdint.h>
+#include <string.h>
+
+namespace preprocess {
+
+// Command line switches shared by the dedupers.
+struct KeySetOptions {
+  unsigned fingerprint_bits;
+  bool incremental, group, interleave;
+  std::size_t expected;
+
+  void Add(boost::program_options::options_description &desc) {
+    namespace po = boost::program_options;
+    desc.add_options()
+      ("compact", po::value(&fingerprint_bits)->default_value(0)->implicit_value(48), "Store 32-bit remainders of line hashes, about 7 bytes per unique line instead of 12.5.  --compact=N (40-56) compares the top N bits of the hash: two distinct lines are treated as duplicates with probability about lines / 2^N.  Default with --compact: 48")
+      ("incremental", po::bool_switch(&incremental)->default_value(false), "Grow the hash table a little on each line instead of all at once.  Avoids long pauses but peaks at 1.5x the memory.")
+      ("group", po::bool_switch(&group)->default_value(false), "Use the SSE2 group-probed hash table.  Ignored with --compact or --incremental.")
+      ("expected", po::value(&expected)->default_value(0), "Size the hash table for this many unique lines up front")
+      ("numa-interleave", po::bool_switch(&interleave)->default_value(false), "Spread the hash table's pages across NUMA nodes.  For tables bigger than one node's memory or shared by threads on several nodes.  Ignored with --compact or --incremental.");
+  }
+};
+
+class KeySet {
+  public:
+    // 0 is not a valid key unless fingerprint_bits is set.  expected_entries
+    // overrides options.expected if nonzero.
+    explicit KeySet(const KeySetOptions &options, std::size_t expected_entries = 0)
+      : full_(options.fingerprint_bits || options.incremental || options.group ? 1 : 10) {
+      if (!expected_entries) expected_entries = options.expected;
+      if (options.fingerprint_bits) {
+        compact_.reset(new util::FingerprintSet(options.fingerprint_bits, expected_entries));
+      } else if (options.incremental) {
+        incremental_.reset(new Incremental());
+        incremental_->Reserve(expected_entries);
+      } else if (options.group) {
+        group_.reset(new Group());
+        if (options.interleave) group_->InterleaveNUMA();
+        group_->Reserve(expected_entries);
+      } else {
+        if (options.interleave) full_.InterleaveNUMA();
+        full_.Reserve(expected_entries);
+      }
+    }
+
+    // Return true if the key was already present.
+    bool FindOrInsert(uint64_t key) {
+      if (compact_) return compact_->FindOrInsert(key);
+      Entry entry;
+      entry.key = key;
+      if (incremental_) {
+        Incremental::MutableIterator it;
+        return incremental_->FindOrInsert(entry, it);
+      }
+      if (group_) {
+        Group::MutableIterator it;
+        return group_->FindOrInsert(entry, it);
+      }
+      Full::MutableIterator it;
+      return full_.FindOrInsert(entry, it);
+    }
+
+    void Prefetch(uint64_t key) const {
+      if (compact_) {
+        compact_->Prefetch(key);
+      } else if (incremental_) {
+        incremental_->Prefetch(key);
+      } else if (group_) {
+        group_->Prefetch(key);
+      } else {
+        full_.Prefetch(key);
+      }
+    }
+
+    // Prefetch all the keys, then FindOrInsert them in order.
+    void FindOrInsertBatch(const uint64_t *keys, std::size_t count, bool *found) {
+      for (std::size_t i = 0; i < count; ++i) Prefetch(keys[i]);
+      for (std::size_t i = 0; i < count; ++i) found[i] = FindOrInsert(keys[i]);
+    }
+
+    std::size_t MemoryUsage() const {
+      if (compact_) return compact_->MemoryUsage();
+      if (incremental_) return incremental_->MemoryUsage();
+      if (group_) return group_->MemoryUsage();
+      return full_.MemoryUsage();
+    }
+
+  private:
+    struct Entry {
+      typedef uint64_t Key;
+      uint64_t key;
+      uint64_t GetKey() const { return key; }
+      void SetKey(uint64_t to) { key = to; }
+    };
+
+    typedef util::AutoProbing<Entry, util::IdentityHash> Full;
+    typedef util::IncrementalProbing<Entry, util::IdentityHash> Incremental;
+    typedef util::AutoGroupProbing<Entry, util::IdentityHash> Group;
+
+    Full full_;
+
+    boost::scoped_ptr<Incremental> incremental_;
+
+    boost::scoped_ptr<Group> group_;
+
+    boost::scoped_ptr<util::FingerprintSet> compact_;
+};
+
+/* Set of lines that is not fooled by hash collisions.  Each entry holds the
+ * line's hash and a pointer to its text in a Pool, so a hash match is only
+ * taken as a duplicate once the bytes compare equal.  Lines whose hashes
+ * collide are chained behind the same entry.  The text is only read when
+ * hashes match; a new line costs a copy into the pool.  Per unique line,
+ * memory is a 16-byte entry in a table of 1.25 to 2.5 buckets per entry (1.5
+ * if --expected was right), so 20 to 40 bytes, plus a 16-byte record header
+ * and the text, rounded up to 8 bytes.
+ */
+class ExactKeySet {
+  public:
+    // Uses options.expected and options.interleave.
+    explicit ExactKeySet(const KeySetOptions &options)
+      // Blocks of 2 MB are backed by huge pages.
+      : text_(1 << 21, 1 << 21), collisions_(0) {
+      if (options.interleave) table_.InterleaveNUMA();
+      table_.Reserve(options.expected);
+    }
+
+    void Prefetch(uint64_t key) const {
+      table_.Prefetch(key);
+    }
+
+    // Return true if text was already present.  key is the hash of text and
+    // must not be 0.
+    bool FindOrInsert(uint64_t key, const StringPiece &text) {
+      Entry entry;
+      entry.key = key;
+      entry.text = NULL;
+      Table::MutableIterator it;
+      if (!table_.FindOrInsert(entry, it)) {
+        it->text = Store(text, NULL);
+        return false;
+      }
+      return Chain(it, text);
+    }
+
+    /* FindOrInsert on each key and text in order, with one table probe per
+     * key.  The probes overlap, then the text of every hit is prefetched
+     * before any is compared.  found[i] is set if texts[i] was present.
+     */
+    void FindOrInsertBatch(const uint64_t *keys, const StringPiece *texts, std::size_t count, bool *found) {
+      entries_.resize(count);
+      its_.resize(count);
+      for (std::size_t i = 0; i < count; ++i) {
+        entries_[i].key = keys[i];
+        entries_[i].text = NULL;
+      }
+      table_.FindOrInsertBatch(&entries_[0], count, &its_[0], found);
+      // A key repeated in the batch is new at its first occurrence, so its
+      // text is stored before the later ones look at it.
+      for (std::size_t i = 0; i < count; ++i) {
+        if (found[i]) {
+          UTIL_PREFETCH(its_[i]->text);
+        } else {
+          its_[i]->text = Store(texts[i], NULL);
+        }
+      }
+      for (std::size_t i = 0; i < count; ++i) {
+        if (found[i]) found[i] = Chain(its_[i], texts[i]);
+      }
+    }
+
+    // Distinct lines that had the same hash as an earlier line.
+    uint64_t Collisions() const { return collisions_; }
+
+    std::size_t MemoryUsage() const {
+      return table_.MemoryUsage() + text_.Reserved();
+    }
+
+  private:
+    // Followed by size bytes of text.
+    struct Record {
+      const Record *next;
+      std::size_t size;
+    };
+
+    struct Entry {
+      typedef uint64_t Key;
+      uint64_t key;
+      const Record *text;
+      uint64_t GetKey() const { return key; }
+      void SetKey(uint64_t to) { key = to; }
+    };
+
+    const Record *Store(const StringPiece &text, const Record *next) {
+      // Keep records aligned for the next one.
+      std::size_t bytes = (sizeof(Record) + text.size() + 7) & ~static_cast<std::size_t>(7);
+      Record *ret = static_cast<Record*>(text_.Allocate(bytes));
+      ret->next = next;
+      ret->size = text.size();
+      memcpy(ret + 1, text.data(), text.size());
+      return ret;
+    }
+
+    typedef util::AutoProbing<Entry, util::IdentityHash> Table;
+
+    // Whether text is in the chain of it, whose key matched.  If not, adds it.
+    bool Chain(Table::MutableIterator it, const StringPiece &text) {
+      for (const Record *r = it->text; r; r = r->next) {
+        if (r->size == static_cast<std::size_t>(text.size()) && !memcmp(r + 1, text.data(), text.size())) return true;
+      }
+      ++collisions_;
+      it->text = Store(text, it->text);
+      return false;
+    }
+
+    Table table_;
+
+    util::Pool text_;
+
+    // Reused by FindOrInsertBatch.
+    std::vector<Entry> entries_;
+    std::vector<Table::MutableIterator> its_;
+
+    uint64_t collisions_;
+};
+
+} // namespace preprocess
+
+#endif // PREPROCESS_KEY_SET__
@@ -3,12 +3,35 @@
 
 #include "util/fake_ofstream.hh"
 #include "util/file_piece.hh"
+#include "util/fixed_array.hh"
 
+#include <boost/bind.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <deque>
 #include <iostream>
+#include <string>
+#include <vector>
 
 #include <stdint.h>
 
-template <class Pass> int FilterParallel(Pass &pass, int argc, char **argv) {
+// Default treatment of parallel lines: both sides have to pass on their own.
+template <class Pass> class PassBoth {
+  public:
+    explicit PassBoth(Pass &pass) : pass_(pass) {}
+
+    bool operator()(const StringPiece &line0, const StringPiece &line1) {
+      return pass_(line0) && pass_(line1);
+    }
+
+  private:
+    Pass &pass_;
+};
+
+// pass filters single lines.  pair_pass filters a pair of parallel lines.
+template <class Pass, class PairPass> int FilterParallel(Pass &pass, PairPass &pair_pass, int argc, char **argv) {
   uint64_t input = 0, output = 0;
   if (argc == 1) {
     StringPiece line;
@@ -34,7 +57,7 @@ template <class Pass> int FilterParallel(Pass &pass, int argc, char **argv) {
       } catch (const util::EndOfFileException &e) { break; }
       line1 = in1.ReadLine();
       ++input;
-      if (pass(line0) && pass(line1)) {
+      if (pair_pass(line0, line1)) {
         out0 << line0 << '\n';
         out1 << line1 << '\n';
         ++output;
@@ -55,4 +78,326 @@ template <class Pass> int FilterParallel(Pass &pass, int argc, char **argv) {
   return 0;
 }
 
+template <class Pass> int FilterParallel(Pass &pass, int argc, char **argv) {
+  PassBoth<Pass> both(pass);
+  return FilterParallel(pass, both, argc, argv);
+}
+
+// Lines copied out of a FilePiece so that a batch of them stays valid.
+class LineBatch {
+  public:
+    void Clear() {
+      text_.clear();
+      ends_.clear();
+    }
+
+    void Add(const StringPiece &line) {
+      text_.append(line.data(), line.size());
+      ends_.push_back(text_.size());
+    }
+
+    std::size_t Size() const { return ends_.size(); }
+
+    // Valid until the next Add or Clear.
+    const StringPiece *Lines() {
+      lines_.resize(ends_.size());
+      for (std::size_t i = 0; i < ends_.size(); ++i) {
+        std::size_t begin = i ? ends_[i - 1] : 0;
+        lines_[i] = StringPiece(text_.data() + begin, ends_[i] - begin);
+      }
+      return lines_.empty() ? NULL : &lines_[0];
+    }
+
+  private:
+    std::string text_;
+    std::vector<std::size_t> ends_;
+    std::vector<StringPiece> lines_;
+};
+
+const std::size_t kFilterBatch = 64;
+
+/* Like FilterParallel, but pass sees up to kFilterBatch lines (or pairs of
+ * lines) at a time so it can overlap work on them, such as hash table cache
+ * misses.  pass must have
+ *   void operator()(const StringPiece *lines, std::size_t count, bool *keep);
+ *   void operator()(const StringPiece *lines0, const StringPiece *lines1, std::size_t count, bool *keep);
+ * and decide the lines in order, as if one at a time.
+ */
+template <class BatchPass> int FilterParallelBatch(BatchPass &pass, int argc, char **argv) {
+  uint64_t input = 0, output = 0;
+  bool keep[kFilterBatch];
+  if (argc == 1) {
+    util::FilePiece in(0, NULL, &std::cerr);
+    util::FakeOFStream out(1);
+    LineBatch batch;
+    StringPiece line;
+    for (bool more = true; more;) {
+      batch.Clear();
+      while (batch.Size() < kFilterBatch && (more = in.ReadLineOrEOF(line))) {
+        batch.Add(line);
+      }
+      const StringPiece *lines = batch.Lines();
+      pass(lines, batch.Size(), keep);
+      for (std::size_t i = 0; i < batch.Size(); ++i) {
+        if (keep[i]) {
+          out << lines[i] << '\n';
+          ++output;
+        }
+      }
+      input += batch.Size();
+    }
+  } else if (argc == 5) {
+    util::FilePiece in0(argv[1], &std::cerr), in1(argv[2]);
+    util::FakeOFStream out0(util::CreateOrThrow(argv[3])), out1(util::CreateOrThrow(argv[4]));
+    LineBatch batch0, batch1;
+    StringPiece line;
+    for (bool more = true; more;) {
+      batch0.Clear();
+      batch1.Clear();
+      while (batch0.Size() < kFilterBatch && (more = in0.ReadLineOrEOF(line))) {
+        batch0.Add(line);
+        batch1.Add(in1.ReadLine());
+      }
+      const StringPiece *lines0 = batch0.Lines(), *lines1 = batch1.Lines();
+      pass(lines0, lines1, batch0.Size(), keep);
+      for (std::size_t i = 0; i < batch0.Size(); ++i) {
+        if (keep[i]) {
+          out0 << lines0[i] << '\n';
+          out1 << lines1[i] << '\n';
+          ++output;
+        }
+      }
+      input += batch0.Size();
+    }
+    if (in1.ReadLineOrEOF(line)) {
+      std::cerr << "Input is not balaced: " << argv[2] << " has " << line << std::endl;
+      return 2;
+    }
+  } else {
+    std::cerr << 
+      "To filter one file, run\n" << argv[0] << " <stdin >stdout\n"
+      "To filter parallel files, run\n" << argv[0] << "in0 in1 out0 out1\n";
+    return 1;
+  }
+  std::cerr << "Kept " << output << " / " << input << " = " << (static_cast<float>(output) / static_cast<float>(input)) << std::endl;
+  return 0;
+}
+
+// A batch of input lines and the text to write for them.
+struct OrderedBatch {
+  OrderedBatch() : done(false) {}
+  LineBatch in;
+  std::string out;
+  // Guarded by BatchQueue's mutex.
+  bool done;
+};
+
+// Hands batches to worker threads and tells the writer when they are done.
+class BatchQueue {
+  public:
+    BatchQueue() : finished_(false) {}
+
+    void Push(OrderedBatch *batch) {
+      boost::unique_lock<boost::mutex> lock(mutex_);
+      batch->done = false;
+      queue_.push_back(batch);
+      work_.notify_one();
+    }
+
+    // No more batches are coming.
+    void Finish() {
+      boost::unique_lock<boost::mutex> lock(mutex_);
+      finished_ = true;
+      work_.notify_all();
+    }
+
+    // Returns NULL once Finish was called and the queue is empty.
+    OrderedBatch *Pop() {
+      boost::unique_lock<boost::mutex> lock(mutex_);
+      while (queue_.empty()) {
+        if (finished_) return NULL;
+        work_.wait(lock);
+      }
+      OrderedBatch *ret = queue_.front();
+      queue_.pop_front();
+      return ret;
+    }
+
+    void MarkDone(OrderedBatch *batch) {
+      boost::unique_lock<boost::mutex> lock(mutex_);
+      batch->done = true;
+      done_.notify_all();
+    }
+
+    void WaitDone(const OrderedBatch *batch) {
+      boost::unique_lock<boost::mutex> lock(mutex_);
+      while (!batch->done) done_.wait(lock);
+    }
+
+  private:
+    boost::mutex mutex_;
+    boost::condition_variable work_, done_;
+    std::deque<OrderedBatch*> queue_;
+    bool finished_;
+};
+
+// Batches are cut at this much text so locking is rare but batches still
+// spread over the threads.
+const std::size_t kOrderedBatchBytes = 1 << 16;
+
+// Returns false if there were no lines left.
+inline bool ReadBatch(util::FilePiece &in, LineBatch &batch, bool strip_cr = false) {
+  batch.Clear();
+  std::size_t bytes = 0;
+  StringPiece line;
+  while (bytes < kOrderedBatchBytes && in.ReadLineOrEOF(line, '\n', strip_cr)) {
+    batch.Add(line);
+    bytes += line.size() + 1;
+  }
+  return batch.Size();
+}
+
+template <class Worker> void WorkOnBatches(BatchQueue *queue, Worker *worker) {
+  while (OrderedBatch *batch = queue->Pop()) {
+    batch->out.clear();
+    (*worker)(batch->in.Lines(), batch->in.Size(), batch->out);
+    queue->MarkDone(batch);
+  }
+}
+
+/* Fills batches with read, has workers turn each batch into text, and hands
+ * the text to sink in input order.  There is one thread per worker, or none if
+ * there is only one.  Reader must have
+ *   bool operator()(LineBatch &batch);
+ * that returns false once there are no lines left, Worker must have
+ *   void operator()(const StringPiece *lines, std::size_t count, std::string &out);
+ * that appends to out, and Sink must have
+ *   void operator()(const std::string &out);
+ * Each worker is only called from one thread; read and sink from this one.
+ */
+template <class Reader, class Worker, class Sink> void ProcessBatchesInOrder(Reader &read, Worker *const *workers, std::size_t threads, Sink &sink) {
+  if (threads == 1) {
+    OrderedBatch batch;
+    while (read(batch.in)) {
+      batch.out.clear();
+      (*workers[0])(batch.in.Lines(), batch.in.Size(), batch.out);
+      sink(batch.out);
+    }
+    return;
+  }
+  BatchQueue queue;
+  boost::thread_group pool;
+  for (std::size_t t = 0; t < threads; ++t) {
+    pool.create_thread(boost::bind(&WorkOnBatches<Worker>, &queue, workers[t]));
+  }
+  // Enough batches in flight to keep every thread busy while the oldest is
+  // written.
+  std::vector<OrderedBatch> batches(2 * threads);
+  std::vector<OrderedBatch*> free;
+  for (std::size_t i = 0; i < batches.size(); ++i) free.push_back(&batches[i]);
+  std::deque<OrderedBatch*> pending;
+  while (true) {
+    if (free.empty()) {
+      queue.WaitDone(pending.front());
+      sink(pending.front()->out);
+      free.push_back(pending.front());
+      pending.pop_front();
+    }
+    if (!read(free.back()->in)) break;
+    pending.push_back(free.back());
+    free.pop_back();
+    queue.Push(pending.back());
+  }
+  queue.Finish();
+  for (; !pending.empty(); pending.pop_front()) {
+    queue.WaitDone(pending.front());
+    sink(pending.front()->out);
+  }
+  pool.join_all();
+}
+
+// Reader for ProcessBatchesInOrder.
+class FileBatchReader {
+  public:
+    FileBatchReader(util::FilePiece &in, bool strip_cr) : in_(in), strip_cr_(strip_cr) {}
+
+    bool operator()(LineBatch &batch) { return ReadBatch(in_, batch, strip_cr_); }
+
+  private:
+    util::FilePiece &in_;
+    const bool strip_cr_;
+};
+
+// Sink for ProcessBatchesInOrder.
+class StreamBatchSink {
+  public:
+    explicit StreamBatchSink(util::FakeOFStream &out) : out_(out) {}
+
+    void operator()(const std::string &text) { out_ << text; }
+
+  private:
+    util::FakeOFStream &out_;
+};
+
+/* Reads lines (keeping any carriage returns unless strip_cr) in batches, has
+ * workers turn each batch into text, and writes the text in input order.
+ * See ProcessBatchesInOrder.
+ */
+template <class Worker> void ProcessInOrder(util::FilePiece &in, util::FakeOFStream &out, Worker *const *workers, std::size_t threads, bool strip_cr = false) {
+  FileBatchReader read(in, strip_cr);
+  StreamBatchSink sink(out);
+  ProcessBatchesInOrder(read, workers, threads, sink);
+}
+
+// Worker for ProcessInOrder that writes the lines pass keeps.
+template <class Pass> class FilterWorker {
+  public:
+    explicit FilterWorker(Pass *pass) : pass_(*pass), input_(0), output_(0) {}
+
+    void operator()(const StringPiece *lines, std::size_t count, std::string &out) {
+      for (const StringPiece *i = lines; i != lines + count; ++i) {
+        if (pass_(*i)) {
+          out.append(i->data(), i->size());
+          out += '\n';
+          ++output_;
+        }
+      }
+      input_ += count;
+    }
+
+    uint64_t Input() const { return input_; }
+    uint64_t Output() const { return output_; }
+
+  private:
+    Pass &pass_;
+    uint64_t input_, output_;
+};
+
+/* FilterParallel with threads.  Thread t calls passes[t], so passes can keep
+ * state without locking.  A single file is filtered in batches and written in
+ * input order, the same as FilterParallel would.  Parallel files are
+ * filtered by passes[0] alone.
+ */
+template <class Pass> int FilterParallelThreads(Pass *const *passes, std::size_t threads, int argc, char **argv) {
+  if (argc != 1 || threads <= 1) return FilterParallel(*passes[0], argc, argv);
+  util::FixedArray<FilterWorker<Pass> > workers(threads);
+  std::vector<FilterWorker<Pass>*> pointers;
+  for (std::size_t t = 0; t < threads; ++t) {
+    workers.push_back(passes[t]);
+    pointers.push_back(&workers[t]);
+  }
+  {
+    util::FilePiece in(0, NULL, &std::cerr);
+    util::FakeOFStream out(1);
+    ProcessInOrder(in, out, &pointers[0], threads, true);
+  }
+  uint64_t input = 0, output = 0;
+  for (std::size_t t = 0; t < threads; ++t) {
+    input += workers[t].Input();
+    output += workers[t].Output();
+  }
+  std::cerr << "Kept " << output << " / " << input << " = " << (static_cast<float>(output) / static_cast<float>(input)) << std::endl;
+  return 0;
+}
+
 #endif
@@ -1,11 +1,14 @@
+#include "preprocess/parallel.hh"
+#include "util/fake_ofstream.hh"
+#include "util/file_piece.hh"
+#include "util/fixed_array.hh"
 #include "util/utf8.hh"
 
 #include <boost/program_options/options_description.hpp>
 #include <boost/program_options/parsers.hpp>
 #include <boost/program_options/variables_map.hpp>
-
-#include <unicode/unistr.h>
-#include <unicode/ustream.h>
+#include <boost/scoped_ptr.hpp>
+#include <boost/utility.hpp>
 
 #include <algorithm>
 #include <string>
@@ -17,6 +20,7 @@ struct Options {
   bool lower;
   bool flatten;
   bool normalize;
+  std::size_t threads;
 };
 void ParseArgs(int argc, char *argv[], Options &out) {
   namespace po = boost::program_options;
@@ -25,33 +29,53 @@ void ParseArgs(int argc, char *argv[], Options &out) {
     ("language,l", po::value(&out.language)->default_value("en"), "Language (only applies to flatten)")
     ("lower", po::bool_switch(&out.lower)->default_value(false), "Convert to lowercase")
     ("flatten", po::bool_switch(&out.flatten)->default_value(false), "Canonicalize some characters for English")
-    ("normalize", po::bool_switch(&out.normalize)->default_value(false), "Normalize Unicode format");
+    ("normalize", po::bool_switch(&out.normalize)->default_value(false), "Normalize Unicode format")
+    ("threads", po::value(&out.threads)->default_value(1), "Threads that process lines.  Output stays in input order");
   po::variables_map vm;
   po::store(po::parse_command_line(argc, argv, desc), vm);
   po::notify(vm);
+  out.threads = std::max<std::size_t>(1, out.threads);
 }
+
+// Applies the options to lines in UTF-8.  Each thread has its own, including
+// its own case map.
+class Process : boost::noncopyable {
+  public:
+    explicit Process(const Options &options)
+      : flattener_(options.language),
+        case_map_(options.lower ? new utf8::CaseMap() : NULL),
+        transform_(case_map_.get(), options.flatten ? &flattener_ : NULL, options.normalize) {}
+
+    void operator()(const StringPiece *lines, std::size_t count, std::string &out) {
+      for (const StringPiece *i = lines; i != lines + count; ++i) {
+        transform_.Apply(*i, line_);
+        out += line_;
+        out += '\n';
+      }
+    }
+
+  private:
+    const utf8::Flatten flattener_;
+
+    boost::scoped_ptr<utf8::CaseMap> case_map_;
+
+    utf8::Transform transform_;
+
+    std::string line_;
+};
+
 } // namespace
 
 int main(int argc, char *argv[]) {
   Options opt;
   ParseArgs(argc, argv, opt);
-  utf8::Flatten flatten(opt.language);
-  std::string line, normalized;
-  UnicodeString str[2];
-  UnicodeString *cur = &str[0], *tmp = &str[1];
-  while (getline(std::cin, line)) {
-    *cur = UnicodeString::fromUTF8(line);
-    if (opt.lower) {
-      cur->toLower();
-    }
-    if (opt.flatten) {
-      flatten.Apply(*cur, *tmp);
-      std::swap(cur, tmp);
-    }
-    if (opt.normalize) {
-      utf8::Normalize(*cur, *tmp);
-      std::swap(cur, tmp);
-    }
-    std::cout << *str << '\n';
+  util::FixedArray<Process> processes(opt.threads);
+  std::vector<Process*> workers;
+  for (std::size_t t = 0; t < opt.threads; ++t) {
+    processes.push_back(opt);
+    workers.push_back(&processes[t]);
   }
+  util::FilePiece in(0);
+  util::FakeOFStream out(1);
+  ProcessInOrder(in, out, &workers[0], opt.threads);
 }
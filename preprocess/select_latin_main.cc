@@ -1,36 +1,44 @@
 #include "preprocess/parallel.hh"
 #include "util/fake_ofstream.hh"
 #include "util/file_piece.hh"
+#include "util/script.hh"
 
 #include <iostream>
-#include <numeric>
 
-#include <stdint.h>
-#include <string.h>
-#include <unicode/uchar.h>
 #include <unicode/uscript.h>
 
+// Only the buckets the decision needs.
+struct LatinCounter {
+  LatinCounter() : latin(0), neutral(0), angle(0), total(0) {}
+
+  void ASCII(std::size_t count, std::size_t letters, std::size_t angle_add) {
+    latin += letters;
+    neutral += count - letters;
+    angle += angle_add;
+    total += count;
+  }
+
+  void Add(UScriptCode script) {
+    latin += (script == USCRIPT_LATIN);
+    neutral += (script == USCRIPT_COMMON) | (script == USCRIPT_INHERITED);
+    ++total;
+  }
+
+  std::size_t latin;
+  // Common and inherited.
+  std::size_t neutral;
+  std::size_t angle;
+  std::size_t total;
+};
+
 struct SelectLatin {
   bool operator()(const StringPiece &line) const {
-    int32_t offset = 0;
-    int32_t length = static_cast<int32_t>(line.size());
-    size_t counts[USCRIPT_CODE_LIMIT];
-    memset(counts, 0, sizeof(counts));
-    size_t angle = 0;
-    while (offset < length) {
-      UChar32 character;
-      U8_NEXT(line.data(), offset, length, character);
-      // Avoid bad unicode and control characters
-      if (character < 32) return false;
-      UErrorCode err = U_ZERO_ERROR;
-      UScriptCode script = uscript_getScript(character, &err);
-      if (U_FAILURE(err) || script == USCRIPT_INVALID_CODE) return false;
-      ++counts[script];
-      if (character == '<' || character == '>') ++angle;
-    }
-    float total = static_cast<float>(std::accumulate(counts, counts + USCRIPT_CODE_LIMIT, 0));
-    if (static_cast<float>(counts[USCRIPT_LATIN] + counts[USCRIPT_INHERITED] + counts[USCRIPT_COMMON] - angle) < total * 0.9) return false;
-    if (static_cast<float>(counts[USCRIPT_LATIN]) < total * 0.5) return false;
+    LatinCounter counts;
+    // Avoid bad unicode and control characters
+    if (!utf8::CountScripts(line, counts)) return false;
+    float total = static_cast<float>(counts.total);
+    if (static_cast<float>(counts.latin + counts.neutral - counts.angle) < total * 0.9) return false;
+    if (static_cast<float>(counts.latin) < total * 0.5) return false;
     return true;
   }
 };
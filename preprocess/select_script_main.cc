@@ -0,0 +1,219 @@
+#include "preprocess/parallel.hh"
+#include "util/fake_ofstream.hh"
+#include "util/file_piece.hh"
+#include "util/fixed_array.hh"
+#include "util/integer_to_string.hh"
+#include "util/script.hh"
+
+#include <boost/program_options/options_description.hpp>
+#include <boost/program_options/parsers.hpp>
+#include <boost/program_options/variables_map.hpp>
+#include <boost/utility.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+#include <unicode/uchar.h>
+#include <unicode/uscript.h>
+
+namespace {
+
+// What a script counts as.
+enum Kind { kOther = 0, kTarget = 1, kNeutral = 2 };
+
+struct Options {
+  std::vector<std::string> targets, neutral;
+  double min_target, min_with_neutral;
+  std::size_t threads;
+  bool profile;
+  std::vector<std::string> files;
+};
+
+// Sums for one line.  '<' and '>' count toward the total and nothing else
+// because they are usually markup.
+struct KindCounter {
+  explicit KindCounter(const uint8_t *kinds_in)
+    : kinds(kinds_in),
+      latin_target(kinds[USCRIPT_LATIN] == kTarget), latin_neutral(kinds[USCRIPT_LATIN] == kNeutral),
+      common_target(kinds[USCRIPT_COMMON] == kTarget), common_neutral(kinds[USCRIPT_COMMON] == kNeutral),
+      target(0), neutral(0), total(0) {}
+
+  void ASCII(std::size_t count, std::size_t letters, std::size_t angle) {
+    std::size_t common = count - letters - angle;
+    target += letters * latin_target + common * common_target;
+    neutral += letters * latin_neutral + common * common_neutral;
+    total += count;
+  }
+
+  void Add(UScriptCode script) {
+    uint8_t kind = kinds[script];
+    target += (kind == kTarget);
+    neutral += (kind == kNeutral);
+    ++total;
+  }
+
+  const uint8_t *const kinds;
+  // What ASCII letters and other ASCII count as.
+  const std::size_t latin_target, latin_neutral, common_target, common_neutral;
+
+  std::size_t target, neutral, total;
+};
+
+// Same decision as select_latin when the target is Latin and the rest are
+// defaults.  Stateless, so threads share it.
+class SelectScript {
+  public:
+    SelectScript(const Options &options, const std::vector<uint8_t> &kinds)
+      : kinds_(kinds), min_target_(options.min_target), min_with_neutral_(options.min_with_neutral) {}
+
+    bool operator()(const StringPiece &line) const {
+      KindCounter counts(&kinds_[0]);
+      // Avoid bad unicode and control characters
+      if (!utf8::CountScripts(line, counts)) return false;
+      float total = static_cast<float>(counts.total);
+      if (static_cast<float>(counts.target + counts.neutral) < total * min_with_neutral_) return false;
+      if (static_cast<float>(counts.target) < total * min_target_) return false;
+      return true;
+    }
+
+  private:
+    const std::vector<uint8_t> &kinds_;
+    const double min_target_, min_with_neutral_;
+};
+
+bool MoreCharacters(const std::pair<std::size_t, UScriptCode> &a, const std::pair<std::size_t, UScriptCode> &b) {
+  return a.first > b.first || (a.first == b.first && a.second < b.second);
+}
+
+// Writes each line's script histogram instead of filtering:
+//   total<tab>Script:count Script:count ...
+// with the most common script first, or "invalid" for lines with bad UTF-8 or
+// control characters.  One per thread.
+class Profile : boost::noncopyable {
+  public:
+    void operator()(const StringPiece *lines, std::size_t count, std::string &out) {
+      for (const StringPiece *i = lines; i != lines + count; ++i) {
+        if (!counts_.Count(*i)) {
+          out += "invalid\n";
+          continue;
+        }
+        counts_.Present(present_);
+        sorted_.clear();
+        for (std::vector<UScriptCode>::const_iterator s = present_.begin(); s != present_.end(); ++s) {
+          sorted_.push_back(std::make_pair(counts_.Get(*s), *s));
+        }
+        std::sort(sorted_.begin(), sorted_.end(), MoreCharacters);
+        AppendNumber(counts_.Total(), out);
+        out += '\t';
+        for (std::vector<std::pair<std::size_t, UScriptCode> >::const_iterator s = sorted_.begin(); s != sorted_.end(); ++s) {
+          if (s != sorted_.begin()) out += ' ';
+          // The tables may know scripts the linked ICU doesn't name.
+          const char *name = uscript_getName(s->second);
+          if (name) {
+            out += name;
+          } else {
+            AppendNumber(s->second, out);
+          }
+          out += ':';
+          AppendNumber(s->first, out);
+        }
+        out += '\n';
+      }
+    }
+
+  private:
+    static void AppendNumber(uint64_t number, std::string &out) {
+      char buf[util::ToStringBuf<uint64_t>::kBytes];
+      out.append(buf, util::ToString(number, buf));
+    }
+
+    utf8::ScriptCounts counts_;
+    std::vector<UScriptCode> present_;
+    std::vector<std::pair<std::size_t, UScriptCode> > sorted_;
+};
+
+// Returns false if a name is not a script.
+bool MarkScripts(const std::vector<std::string> &names, Kind kind, std::vector<uint8_t> &kinds) {
+  for (std::vector<std::string>::const_iterator i = names.begin(); i != names.end(); ++i) {
+    int32_t script = u_getPropertyValueEnum(UCHAR_SCRIPT, i->c_str());
+    if (script < 0 || static_cast<std::size_t>(script) >= kinds.size()) {
+      std::cerr << "Unknown script " << *i << std::endl;
+      return false;
+    }
+    kinds[script] = kind;
+  }
+  return true;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  namespace po = boost::program_options;
+  Options opt;
+  po::options_description desc("Script selection options");
+  desc.add_options()
+    ("script,s", po::value(&opt.targets)->composing(), "Script to keep, by Unicode name such as Latin, Cyrillic, Greek, Han, or short name such as Cyrl.  Repeat for several.")
+    ("neutral", po::value(&opt.neutral)->composing(), "Scripts that go with any target.  Default: Common Inherited")
+    ("min", po::value(&opt.min_target)->default_value(0.5, "0.5"), "Least fraction of characters in the target scripts")
+    ("min-with-neutral", po::value(&opt.min_with_neutral)->default_value(0.9, "0.9"), "Least fraction of characters in the target or neutral scripts")
+    ("threads", po::value(&opt.threads)->default_value(1), "Threads for filtering stdin.  Output stays in input order")
+    ("profile", po::bool_switch(&opt.profile)->default_value(false), "Instead of filtering, write each line's script histogram");
+  po::options_description hidden;
+  hidden.add_options()("file", po::value(&opt.files)->composing());
+  po::options_description all;
+  all.add(desc).add(hidden);
+  po::positional_options_description positional;
+  positional.add("file", -1);
+  po::variables_map vm;
+  try {
+    po::store(po::command_line_parser(argc, argv).options(all).positional(positional).run(), vm);
+    po::notify(vm);
+  } catch (const po::error &e) {
+    std::cerr << e.what() << '\n' << desc << std::endl;
+    return 1;
+  }
+  opt.threads = std::max<std::size_t>(1, opt.threads);
+
+  if (opt.profile) {
+    if (!opt.files.empty()) {
+      std::cerr << "--profile reads stdin and writes stdout" << std::endl;
+      return 1;
+    }
+    util::FixedArray<Profile> profiles(opt.threads);
+    std::vector<Profile*> workers;
+    for (std::size_t t = 0; t < opt.threads; ++t) {
+      profiles.push_back();
+      workers.push_back(&profiles[t]);
+    }
+    util::FilePiece in(0);
+    util::FakeOFStream out(1);
+    ProcessInOrder(in, out, &workers[0], opt.threads, true);
+    return 0;
+  }
+
+  if (opt.targets.empty()) {
+    std::cerr << "Pick at least one --script to keep.\n" << desc << std::endl;
+    return 1;
+  }
+  if (!vm.count("neutral")) {
+    opt.neutral.push_back("Common");
+    opt.neutral.push_back("Inherited");
+  }
+  std::vector<uint8_t> kinds(utf8::kScriptLimit, kOther);
+  // Targets win over neutral.
+  if (!MarkScripts(opt.neutral, kNeutral, kinds) || !MarkScripts(opt.targets, kTarget, kinds)) return 1;
+
+  SelectScript select(opt, kinds);
+  std::vector<SelectScript*> passes(opt.threads, &select);
+  // Hand FilterParallelThreads the same argument shape FilterParallel always had.
+  std::vector<char*> args;
+  args.push_back(argv[0]);
+  for (std::vector<std::string>::iterator i = opt.files.begin(); i != opt.files.end(); ++i) {
+    args.push_back(&(*i)[0]);
+  }
+  args.push_back(NULL);
+  return FilterParallelThreads(&passes[0], opt.threads, static_cast<int>(args.size() - 1), &args[0]);
+}
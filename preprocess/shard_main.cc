@@ -1,27 +1,44 @@
 #include "util/fake_ofstream.hh"
+#include "util/fast_hash.hh"
 #include "util/file_piece.hh"
 #include "util/fixed_array.hh"
-#include "util/murmur_hash.hh"
 
 #include <boost/lexical_cast.hpp>
 
+#include <string.h>
+
+// Be different from deduper.
+const uint64_t kSeed = 47849374332489ULL;
+
+template <class Hasher> void Shard(util::FixedArray<util::FakeOFStream> &out) {
+  util::FilePiece in(0);
+  StringPiece line;
+  Hasher hasher;
+  while (in.ReadLineOrEOF(line)) {
+    out[hasher(line.data(), line.size(), kSeed) % out.size()] << line << '\n';
+  }
+}
+
 int main(int argc, char *argv[]) {
-  if (argc != 3) {
-    std::cerr << "Usage: " << argv[0] << " file_prefix shard_count\n"
+  bool fast = argc == 5 && !strcmp(argv[3], "--hash") && !strcmp(argv[4], "fast");
+  bool murmur = argc == 5 && !strcmp(argv[3], "--hash") && !strcmp(argv[4], "murmur");
+  if (argc != 3 && !fast && !murmur) {
+    std::cerr << "Usage: " << argv[0] << " file_prefix shard_count [--hash fast|murmur]\n"
       "Shards stdin into multiple files by the hash of the line.\n"
-      "The files will be named as file_prefix0 file_prefix1 etc.\n";
+      "The files will be named as file_prefix0 file_prefix1 etc.\n"
+      "The default murmur hash puts lines in the same shards as older versions.\n";
     return 1;
   }
-  util::FilePiece in(0);
-  StringPiece line;
   uint64_t shard_count = boost::lexical_cast<unsigned>(argv[2]);
   util::FixedArray<util::FakeOFStream> out(shard_count);
   std::string output(argv[1]);
   for (uint64_t i = 0; i < shard_count; ++i) {
     out.push_back(util::CreateOrThrow((output + boost::lexical_cast<std::string>(i)).c_str()));
   }
-  while (in.ReadLineOrEOF(line)) {
-    out[util::MurmurHashNative(line.data(), line.size(), 47849374332489ULL /* Be different from deduper */) % shard_count] << line << '\n';
+  if (fast) {
+    Shard<util::FastHasher>(out);
+  } else {
+    Shard<util::MurmurHasher>(out);
   }
   return 0;
 }
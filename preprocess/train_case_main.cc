@@ -5,7 +5,6 @@
 #include "util/tokenize_piece.hh"
 #include "util/utf8.hh"
 
-#include <boost/lexical_cast.hpp>
 #include <boost/unordered_map.hpp>
 
 namespace {
@@ -43,7 +42,7 @@ class Recorder {
     void Dump() {
       util::FakeOFStream out(1);
       for (Map::const_iterator i = map_.begin(); i != map_.end(); ++i) {
-        out << boost::lexical_cast<std::string>(i->first);
+        out << i->first;
         for (boost::unordered_map<uint32_t, unsigned int>::const_iterator j = i->second.begin(); j != i->second.end(); ++j) {
           out << '\t' << vocab_.String(j->first) << ' ' << j->second;
         }
@@ -1,25 +1,37 @@
 #include "util/file_piece.hh"
 #include "util/fake_ofstream.hh"
-#include "util/murmur_hash.hh"
+#include "util/fast_hash.hh"
+#include "util/group_probing_hash_table.hh"
 #include "util/pool.hh"
 #include "util/probing_hash_table.hh"
 #include "util/tokenize_piece.hh"
 #include "util/utf8.hh"
 
-#include <string.h>
+#include <functional>
 
-uint64_t Hash(const StringPiece &str) {
-  return util::MurmurHashNative(str.data(), str.size());
-}
+#include <string.h>
 
-class Truecase {
+// TableT is util::AutoProbing or util::AutoGroupProbing and HashT is
+// util::MurmurHasher or util::FastHasher.
+template <template <class, class, class> class TableT, class HashT> class Truecase {
   public:
     explicit Truecase(const char *file);
 
     // Apply truecasing, using temp as a buffer (to remain const and fast).
     void Apply(const StringPiece &line, std::string &temp, util::FakeOFStream &out) const;
 
+    // Memory held by the model, for sizing jobs.
+    void PrintStats(std::ostream &to) const {
+      to << "Model entries: " << table_.Size() << '\n'
+        << "Hash table: " << table_.MemoryUsage() << " bytes\n"
+        << "Strings: " << string_pool_.Requested() << " bytes requested, " << string_pool_.Reserved() << " reserved, " << string_pool_.Wasted() << " wasted" << std::endl;
+    }
+
   private:
+    static uint64_t Hash(const StringPiece &str) {
+      return HashT()(str.data(), str.size());
+    }
+
     struct TableEntry {
       typedef uint64_t Key;
       Key key;
@@ -39,7 +51,7 @@ class Truecase {
       entry.sentence_end = false;
       entry.delayed_sentence_start = false;
       entry.known = true;
-      Table::MutableIterator it;
+      typename Table::MutableIterator it;
       if (!table_.FindOrInsert(entry, it)) {
         char *start = static_cast<char*>(memcpy(string_pool_.Allocate(word.size() + 1), word.data(), word.size()));
         start[word.size()] = '\0';
@@ -57,19 +69,19 @@ class Truecase {
       entry.delayed_sentence_start = false;
       entry.best = best;
       entry.known = known;
-      Table::MutableIterator it;
+      typename Table::MutableIterator it;
       table_.FindOrInsert(entry, it);
       it->known |= known;
     }
 
     util::Pool string_pool_;
 
-    typedef util::AutoProbing<TableEntry, util::IdentityHash> Table;
+    typedef TableT<TableEntry, util::IdentityHash, std::equal_to<uint64_t> > Table;
 
     Table table_;
 };
 
-Truecase::Truecase(const char *file) {
+template <template <class, class, class> class TableT, class HashT> Truecase<TableT, HashT>::Truecase(const char *file) {
   // Sentence ends.
   const char *kEndSentence[] = { ".", ":", "?", "!"};
   for (const char *const *i = kEndSentence; i != kEndSentence + sizeof(kEndSentence) / sizeof(const char*); ++i)
@@ -96,56 +108,104 @@ Truecase::Truecase(const char *file) {
   }
 }
 
-void Truecase::Apply(const StringPiece &line, std::string &temp, util::FakeOFStream &out) const {
-  bool sentence_start = true;
+template <template <class, class, class> class TableT, class HashT> void Truecase<TableT, HashT>::Apply(const StringPiece &line, std::string &temp, util::FakeOFStream &out) const {
+  // Words are looked up a batch at a time so their cache misses overlap.
+  const std::size_t kBatch = 64;
+  StringPiece words[kBatch];
+  uint64_t keys[kBatch];
+  const TableEntry *entries[kBatch];
+  bool found[kBatch];
+  bool sentence_start = true, first = true;
   for (util::TokenIter<util::BoolCharacter, true> word(line, util::kSpaces); word;) {
-    const TableEntry *entry;
-    bool entry_found = table_.Find(Hash(*word), entry);
-    // If they're known and not the beginning of sentence, pass through.
-    if (entry_found && entry->known && !sentence_start) {
-      out << *word;
-    } else {
-      try {
-        utf8::ToLower(*word, temp);
-      } catch (const utf8::NotUTF8Exception &e) {
-        std::cerr << e.what() << "\nSkipping this word.\n";
-        continue;
-      }
-      const TableEntry *lower;
-      if (table_.Find(Hash(temp), lower)) {
-        // If there's a best form, print it.
-        out << lower->best;
+    std::size_t count = 0;
+    for (; word && count < kBatch; ++word, ++count) {
+      words[count] = *word;
+      keys[count] = Hash(*word);
+    }
+    table_.FindBatch(keys, count, entries, found);
+    for (std::size_t i = 0; i < count; ++i) {
+      const TableEntry *entry = entries[i];
+      bool entry_found = found[i];
+      // If they're known and not the beginning of sentence, pass through.
+      if (entry_found && entry->known && !sentence_start) {
+        if (!first) out << ' ';
+        out << words[i];
       } else {
-        // Pass unknowns through.
-        out << *word;
+        try {
+          utf8::ToLower(words[i], temp);
+        } catch (const utf8::NotUTF8Exception &e) {
+          std::cerr << e.what() << "\nSkipping this word.\n";
+          continue;
+        }
+        if (!first) out << ' ';
+        const TableEntry *lower;
+        if (table_.Find(Hash(temp), lower)) {
+          // If there's a best form, print it.
+          out << lower->best;
+        } else {
+          // Pass unknowns through.
+          out << words[i];
+        }
       }
-    }
-    if (entry_found) {
-      if (entry->sentence_end) {
-        sentence_start = true;
-      } else if (!entry->delayed_sentence_start) {
+      first = false;
+      if (entry_found) {
+        if (entry->sentence_end) {
+          sentence_start = true;
+        } else if (!entry->delayed_sentence_start) {
+          sentence_start = false;
+        }
+      } else {
         sentence_start = false;
       }
-    } else {
-      sentence_start = false;
     }
-    if (++word) out << ' ';
   }
   out << '\n';
 }
 
-int main(int argc, char *argv[]) {
-  if (argc != 3 || (strcmp(argv[1], "--model") && strcmp(argv[1], "-model"))) {
-    std::cerr << "Fast reimplementation of Moses scripts/recaser/truecase.perl except it does not support factors." << std::endl;
-    std::cerr << argv[0] << " --model $model <in >out" << std::endl;
-    return 1;
-  }
-  Truecase caser(argv[2]);
+template <template <class, class, class> class TableT, class HashT> void Run(const char *model, bool stats) {
+  Truecase<TableT, HashT> caser(model);
+  if (stats) caser.PrintStats(std::cerr);
   util::FakeOFStream out(1);
   StringPiece line;
   std::string temp;
   for (util::FilePiece f(0); f.ReadLineOrEOF(line);) {
     caser.Apply(line, temp, out);
   }
+}
+
+template <template <class, class, class> class TableT> void Run(const char *model, bool fast, bool stats) {
+  if (fast) {
+    Run<TableT, util::FastHasher>(model, stats);
+  } else {
+    Run<TableT, util::MurmurHasher>(model, stats);
+  }
+}
+
+int main(int argc, char *argv[]) {
+  bool group = false, fast = false, stats = false, usage = argc < 3 || (strcmp(argv[1], "--model") && strcmp(argv[1], "-model"));
+  for (int i = 3; i < argc && !usage; ++i) {
+    if (!strcmp(argv[i], "--group")) {
+      group = true;
+    } else if (!strcmp(argv[i], "--stats")) {
+      stats = true;
+    } else if (!strcmp(argv[i], "--hash") && i + 1 < argc && (!strcmp(argv[i + 1], "fast") || !strcmp(argv[i + 1], "murmur"))) {
+      fast = !strcmp(argv[++i], "fast");
+    } else {
+      usage = true;
+    }
+  }
+  if (usage) {
+    std::cerr << "Fast reimplementation of Moses scripts/recaser/truecase.perl except it does not support factors." << std::endl;
+    std::cerr << argv[0] << " --model $model [--group] [--hash fast|murmur] [--stats] <in >out" << std::endl;
+    std::cerr << "--group uses the SSE2 group-probed hash table." << std::endl;
+    std::cerr << "--hash fast hashes words with util::FastHash instead of MurmurHash." << std::endl;
+    std::cerr << "--stats prints the memory used by the model to stderr." << std::endl;
+    return 1;
+  }
+  if (group) {
+    Run<util::AutoGroupProbing>(argv[2], fast, stats);
+  } else {
+    Run<util::AutoProbing>(argv[2], fast, stats);
+  }
   return 0;
 }
@@ -0,0 +1,32 @@
+#include "util/fake_ofstream.hh"
+#include "util/file_piece.hh"
+#include "util/mutable_vocab.hh"
+#include "util/tokenize_piece.hh"
+
+#include <iostream>
+
+// Replaces each word on stdin with its ID in a vocabulary from bin/vocab
+// --save.  The vocabulary is mapped, not parsed, so starting is quick however
+// big it is.
+int main(int argc, char *argv[]) {
+  if (argc != 2) {
+    std::cerr << "Usage: " << argv[0] << " vocabulary <in >out\n"
+      "Replaces each word with its ID in a vocabulary written by bin/vocab --save, or\n"
+      "0 for words not in it.  Words are separated as bin/vocab separates them and\n"
+      "lines are kept." << std::endl;
+    return 1;
+  }
+  util::MappedVocab vocab(argv[1]);
+  // The delimiters of bin/vocab other than newline.
+  const util::AnyCharacter delimiters(StringPiece(" \t\r\0", 4));
+  util::FilePiece in(0);
+  util::FakeOFStream out(1);
+  StringPiece line;
+  while (in.ReadLineOrEOF(line)) {
+    for (util::TokenIter<util::AnyCharacter, true> word(line, delimiters); word;) {
+      out << vocab.Find(*word);
+      if (++word) out << ' ';
+    }
+    out << '\n';
+  }
+}
@@ -1,11 +1,27 @@
+#include "preprocess/parallel.hh"
 #include "util/file_piece.hh"
 #include "util/fake_ofstream.hh"
+#include "util/fixed_array.hh"
+#include "util/group_probing_hash_table.hh"
 #include "util/murmur_hash.hh"
+#include "util/mutable_vocab.hh"
+#include "util/pool.hh"
 #include "util/probing_hash_table.hh"
+#include "util/read_compressed.hh"
 
-#include <boost/unordered_set.hpp>
+#include <boost/bind.hpp>
+#include <boost/program_options/options_description.hpp>
+#include <boost/program_options/parsers.hpp>
+#include <boost/program_options/variables_map.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
 
+#include <algorithm>
+#include <deque>
 #include <iostream>
+#include <string>
+#include <vector>
 
 #include <string.h>
 
@@ -16,29 +32,398 @@ struct Entry {
   void SetKey(uint64_t to) { key = to; }
 };
 
+class Delimiters {
+  public:
+    Delimiters() {
+      memset(is_, 0, sizeof(is_));
+      is_['\0'] = true;
+      is_['\t'] = true;
+      is_['\r'] = true;
+      is_['\n'] = true;
+      is_[' '] = true;
+    }
+
+    const bool *Get() const { return is_; }
+
+    bool operator()(char c) const { return is_[static_cast<unsigned char>(c)]; }
+
+  private:
+    bool is_[256];
+};
 
-int main() {
-  bool delimiters[256];
-  memset(delimiters, 0, sizeof(delimiters));
-  delimiters['\0'] = true;
-  delimiters['\t'] = true;
-  delimiters['\r'] = true;
-  delimiters['\n'] = true;
-  delimiters[' '] = true;
+// Table is AutoProbing or AutoGroupProbing.
+template <class Table> void Unique() {
+  Delimiters delimiters;
 
-  util::AutoProbing<Entry, util::IdentityHash> seen;
+  Table seen;
 
   util::FilePiece in(0, "stdin", &std::cerr);
   util::FakeOFStream out(1);
 
-  util::AutoProbing<Entry, util::IdentityHash>::MutableIterator it;
-  Entry entry;
+  // Words are copied so a batch of them can be looked up with prefetching.
+  LineBatch words;
+  Entry entries[kFilterBatch];
+  typename Table::MutableIterator its[kFilterBatch];
+  bool found[kFilterBatch];
+
+  for (bool more = true; more;) {
+    words.Clear();
+    try {
+      while (words.Size() < kFilterBatch) {
+        StringPiece word = in.ReadDelimited(delimiters.Get());
+        entries[words.Size()].SetKey(util::MurmurHashNative(word.data(), word.size()));
+        words.Add(word);
+      }
+    } catch (const util::EndOfFileException &e) { more = false; }
+    seen.FindOrInsertBatch(entries, words.Size(), its, found);
+    const StringPiece *pieces = words.Lines();
+    for (std::size_t i = 0; i < words.Size(); ++i) {
+      if (!found[i]) out << pieces[i] << '\0';
+    }
+  }
+}
+
+// Input is cut into chunks at delimiters so each can be counted on its own.
+struct Chunk {
+  std::string text;
+  uint64_t number;
+};
+
+const std::size_t kChunkSize = 1 << 20;
+
+struct WordCount {
+  StringPiece word;
+  uint64_t count;
+  // Position of the first occurrence: chunk number in the top 32 bits, word
+  // within the chunk in the bottom 32 bits.
+  uint64_t first;
+};
+
+// Counts words in chunks.  Each thread has its own, merged at the end.
+template <class Table> class Counter {
+  public:
+    explicit Counter(util::ThreadLocalPool *pools) : pools_(*pools), strings_(NULL) {}
+
+    // Call from the counting thread so its strings go in that thread's pool.
+    void Count(const Chunk &chunk) {
+      if (!strings_) strings_ = &pools_.Local();
+      const Delimiters delimiters;
+      util::MutableVocabInternal entries[kFilterBatch];
+      StringPiece words[kFilterBatch];
+      typename Table::MutableIterator its[kFilterBatch];
+      bool found[kFilterBatch];
+      uint64_t position = chunk.number << 32;
+      const char *i = chunk.text.data(), *end = i + chunk.text.size();
+      while (i != end) {
+        std::size_t batch = 0;
+        for (; batch < kFilterBatch; ++batch) {
+          for (; i != end && delimiters(*i); ++i) {}
+          if (i == end) break;
+          const char *word = i;
+          for (; i != end && !delimiters(*i); ++i) {}
+          words[batch] = StringPiece(word, i - word);
+          entries[batch].key = util::MurmurHashNative(word, i - word);
+          entries[batch].id = 0;
+        }
+        table_.FindOrInsertBatch(entries, batch, its, found);
+        for (std::size_t b = 0; b < batch; ++b, ++position) {
+          if (found[b]) {
+            ++counts_[its[b]->id].count;
+          } else {
+            // A word repeated within the batch was inserted by its first
+            // occurrence, so IDs are handed out in order.
+            its[b]->id = counts_.size();
+            WordCount add;
+            char *copied = static_cast<char*>(strings_->Allocate(words[b].size()));
+            memcpy(copied, words[b].data(), words[b].size());
+            add.word = StringPiece(copied, words[b].size());
+            add.count = 1;
+            add.first = position;
+            counts_.push_back(add);
+          }
+        }
+      }
+    }
+
+    // Strings stay in other's pool.
+    void Merge(const Counter &other) {
+      util::MutableVocabInternal entry;
+      typename Table::MutableIterator it;
+      for (typename std::vector<WordCount>::const_iterator i = other.counts_.begin(); i != other.counts_.end(); ++i) {
+        entry.key = util::MurmurHashNative(i->word.data(), i->word.size());
+        entry.id = counts_.size();
+        if (table_.FindOrInsert(entry, it)) {
+          WordCount &to = counts_[it->id];
+          to.count += i->count;
+          to.first = std::min(to.first, i->first);
+        } else {
+          counts_.push_back(*i);
+        }
+      }
+    }
+
+    std::vector<WordCount> &Counts() { return counts_; }
+
+    // Bytes in the table and counts, not the strings.
+    std::size_t MemoryUsage() const {
+      return table_.MemoryUsage() + counts_.capacity() * sizeof(WordCount);
+    }
+
+  private:
+    Table table_;
+
+    std::vector<WordCount> counts_;
+
+    util::ThreadLocalPool &pools_;
+    util::Pool *strings_;
+};
+
+// Hands chunks from the reader to the counting threads.
+class ChunkQueue {
+  public:
+    explicit ChunkQueue(std::size_t bound) : bound_(bound), done_(false) {}
+
+    void Push(Chunk &chunk) {
+      boost::unique_lock<boost::mutex> lock(mutex_);
+      while (queue_.size() >= bound_) not_full_.wait(lock);
+      queue_.push_back(Chunk());
+      queue_.back().text.swap(chunk.text);
+      queue_.back().number = chunk.number;
+      not_empty_.notify_one();
+    }
+
+    void Done() {
+      boost::unique_lock<boost::mutex> lock(mutex_);
+      done_ = true;
+      not_empty_.notify_all();
+    }
+
+    // Returns false once Done was called and the queue is empty.
+    bool Pop(Chunk &chunk) {
+      boost::unique_lock<boost::mutex> lock(mutex_);
+      while (queue_.empty()) {
+        if (done_) return false;
+        not_empty_.wait(lock);
+      }
+      chunk.text.swap(queue_.front().text);
+      chunk.number = queue_.front().number;
+      queue_.pop_front();
+      not_full_.notify_one();
+      return true;
+    }
+
+  private:
+    boost::mutex mutex_;
+    boost::condition_variable not_full_, not_empty_;
+    std::deque<Chunk> queue_;
+    const std::size_t bound_;
+    bool done_;
+};
+
+template <class CounterT> void CountFromQueue(ChunkQueue *queue, CounterT *counter) {
+  Chunk chunk;
+  while (queue->Pop(chunk)) counter->Count(chunk);
+}
+
+/* Reads stdin in chunks ending at a delimiter and calls process on each.
+ * Input can be compressed.
+ */
+template <class Process> void ReadChunks(Process &process) {
+  const Delimiters delimiters;
+  util::ReadCompressed in(util::DupOrThrow(0));
+  Chunk chunk;
+  chunk.number = 0;
+  std::string carry;
+  for (bool more = true; more;) {
+    chunk.text.swap(carry);
+    carry.clear();
+    std::size_t start = chunk.text.size();
+    chunk.text.resize(start + kChunkSize);
+    std::size_t got = 0;
+    while (got < kChunkSize) {
+      std::size_t read = in.Read(&chunk.text[start + got], kChunkSize - got);
+      if (!read) {
+        more = false;
+        break;
+      }
+      got += read;
+    }
+    chunk.text.resize(start + got);
+    if (more) {
+      // Move the partial word at the end to the next chunk.
+      std::size_t cut = chunk.text.size();
+      while (cut && !delimiters(chunk.text[cut - 1])) --cut;
+      carry.assign(chunk.text, cut, std::string::npos);
+      chunk.text.resize(cut);
+      // The chunk is all one word so far.
+      if (!cut) continue;
+    }
+    process(chunk);
+    ++chunk.number;
+  }
+}
+
+class PushTo {
+  public:
+    explicit PushTo(ChunkQueue &queue) : queue_(queue) {}
+    void operator()(Chunk &chunk) { queue_.Push(chunk); }
+  private:
+    ChunkQueue &queue_;
+};
+
+template <class CounterT> class CountDirectly {
+  public:
+    explicit CountDirectly(CounterT &counter) : counter_(counter) {}
+    void operator()(Chunk &chunk) { counter_.Count(chunk); }
+  private:
+    CounterT &counter_;
+};
+
+struct FirstOrder {
+  bool operator()(const WordCount &a, const WordCount &b) const {
+    return a.first < b.first;
+  }
+};
+
+// Most frequent first, ties in the order they appeared.
+struct FrequencyOrder {
+  bool operator()(const WordCount &a, const WordCount &b) const {
+    return a.count > b.count || (a.count == b.count && a.first < b.first);
+  }
+};
+
+struct BelowCount {
+  explicit BelowCount(uint64_t min) : min_count(min) {}
+  bool operator()(const WordCount &a) const { return a.count < min_count; }
+  uint64_t min_count;
+};
+
+struct CountOptions {
+  bool print_count;
+  bool sort_frequency;
+  uint64_t top;
+  uint64_t min_count;
+  std::size_t threads;
+  bool stats;
+  // Where to save the printed words as a util::MutableVocab, if anywhere.
+  std::string save;
+};
+
+template <class Table> void Count(const CountOptions &options) {
+  typedef Counter<Table> CounterT;
+  // Fixed 2 MB blocks are backed by huge pages and waste at most 2 MB each.
+  util::ThreadLocalPool strings(1 << 21, 1 << 21);
+  util::FixedArray<CounterT> counters(options.threads);
+  for (std::size_t t = 0; t < options.threads; ++t) {
+    counters.push_back(&strings);
+  }
+  if (options.threads == 1) {
+    CountDirectly<CounterT> process(counters[0]);
+    ReadChunks(process);
+  } else {
+    ChunkQueue queue(2 * options.threads);
+    boost::thread_group pool;
+    for (std::size_t t = 0; t < options.threads; ++t) {
+      pool.create_thread(boost::bind(&CountFromQueue<CounterT>, &queue, &counters[t]));
+    }
+    PushTo process(queue);
+    ReadChunks(process);
+    queue.Done();
+    pool.join_all();
+    for (std::size_t t = 1; t < options.threads; ++t) {
+      counters[0].Merge(counters[t]);
+    }
+  }
+
+  if (options.stats) {
+    std::size_t tables = 0;
+    for (std::size_t t = 0; t < options.threads; ++t) {
+      tables += counters[t].MemoryUsage();
+    }
+    std::cerr << "Distinct words: " << counters[0].Counts().size() << '\n'
+      << "Tables and counts: " << tables << " bytes\n"
+      << "Strings: " << strings.Requested() << " bytes requested, " << strings.Reserved() << " reserved, " << strings.Wasted() << " wasted" << std::endl;
+  }
+
+  std::vector<WordCount> &counts = counters[0].Counts();
+  counts.erase(std::remove_if(counts.begin(), counts.end(), BelowCount(options.min_count)), counts.end());
+  if (options.top && options.top < counts.size()) {
+    std::partial_sort(counts.begin(), counts.begin() + options.top, counts.end(), FrequencyOrder());
+    counts.resize(options.top);
+  } else if (options.sort_frequency || options.top) {
+    std::sort(counts.begin(), counts.end(), FrequencyOrder());
+  } else {
+    std::sort(counts.begin(), counts.end(), FirstOrder());
+  }
+
+  util::FakeOFStream out(1);
+  for (std::vector<WordCount>::const_iterator i = counts.begin(); i != counts.end(); ++i) {
+    if (options.print_count) {
+      out << i->word << '\t' << i->count << '\n';
+    } else {
+      out << i->word << '\0';
+    }
+  }
+
+  if (!options.save.empty()) {
+    // IDs are 1, 2, ... in output order after <unk>.
+    util::MutableVocab vocab;
+    for (std::vector<WordCount>::const_iterator i = counts.begin(); i != counts.end(); ++i) {
+      vocab.FindOrInsert(i->word);
+    }
+    vocab.Save(options.save.c_str());
+  }
+}
+
+int main(int argc, char *argv[]) {
+  namespace po = boost::program_options;
+  po::options_description desc(
+      "Prints each distinct word in stdin once, in the order first seen.  Words\n"
+      "are separated by spaces, tabs, newlines, carriage returns, and NULs.  Each\n"
+      "word is followed by NUL, or with --count by a tab, its count, and newline");
+  bool group, print_count;
+  std::string sort;
+  CountOptions options;
+  desc.add_options()
+    ("help,h", po::bool_switch(), "Show this help message")
+    ("group", po::bool_switch(&group)->default_value(false), "Use the SSE2 group-probed hash table")
+    ("count", po::bool_switch(&print_count)->default_value(false), "Print how many times each word appeared")
+    ("sort", po::value(&sort)->default_value("first"), "Order of output: first (first seen) or freq (most frequent first, ties in first seen order)")
+    ("top", po::value(&options.top)->default_value(0), "Only print this many most frequent words, most frequent first.  0 prints all")
+    ("min-count", po::value(&options.min_count)->default_value(1), "Only print words that appeared at least this many times")
+    ("threads", po::value(&options.threads)->default_value(1), "Threads that count words.  Each counts its own chunks of input and the counts are merged at the end")
+    ("stats", po::bool_switch(&options.stats)->default_value(false), "Print memory used for counting to stderr.  Implies counting")
+    ("save", po::value(&options.save), "Also save the printed words, in order, as a vocabulary file for bin/vocab_ids.  Implies counting");
+  po::variables_map vm;
+  try {
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    if (vm["help"].as<bool>()) {
+      std::cerr << desc << std::endl;
+      return 1;
+    }
+    po::notify(vm);
+  } catch (const po::error &e) {
+    std::cerr << e.what() << '\n' << desc << std::endl;
+    return 1;
+  }
+  if (sort != "first" && sort != "freq") {
+    std::cerr << "--sort must be first or freq, not " << sort << std::endl;
+    return 1;
+  }
+  options.print_count = print_count;
+  options.sort_frequency = (sort == "freq");
+  options.threads = std::max<std::size_t>(1, options.threads);
 
-  try { while (true) {
-    StringPiece word = in.ReadDelimited(delimiters);
-    entry.SetKey(util::MurmurHashNative(word.data(), word.size()));
-    if (!seen.FindOrInsert(entry, it)) {
-      out << word << '\0';
+  // Without counting, print words as they are seen instead of at the end.
+  if (!print_count && !options.sort_frequency && !options.top && options.min_count <= 1 && options.threads == 1 && !options.stats && options.save.empty()) {
+    if (group) {
+      Unique<util::AutoGroupProbing<Entry, util::IdentityHash> >();
+    } else {
+      Unique<util::AutoProbing<Entry, util::IdentityHash> >();
     }
-  } } catch (const util::EndOfFileException &e) {}
+  } else if (group) {
+    Count<util::AutoGroupProbing<util::MutableVocabInternal, util::IdentityHash> >(options);
+  } else {
+    Count<util::AutoProbing<util::MutableVocabInternal, util::IdentityHash> >(options);
+  }
 }
@@ -0,0 +1,123 @@
+#include "util/concurrent_vocab.hh"
+
+#include "util/probing_hash_table.hh"
+
+#include <boost/thread/thread_only.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <utility>
+
+namespace util {
+
+template <class HashT> const typename GenericConcurrentVocab<HashT>::ID GenericConcurrentVocab<HashT>::kUNK;
+template <class HashT> const typename GenericConcurrentVocab<HashT>::ID GenericConcurrentVocab<HashT>::kFull;
+
+template <class HashT> GenericConcurrentVocab<HashT>::GenericConcurrentVocab(std::size_t max_words, std::size_t threads)
+  // Each thread can claim one bucket past max_words before it throws.
+  : max_size_(max_words + 1),
+    bucket_count_(std::max<std::size_t>(max_words + threads + 1, (max_words + threads) * 3 / 2)),
+    next_(1),
+    arenas_(threads) {
+  HugeMalloc(bucket_count_ * sizeof(Bucket), false, bucket_mem_);
+  buckets_ = static_cast<Bucket*>(bucket_mem_.get());
+  // Atomics are only atomics once constructed.  They are trivially
+  // destructible, so the memory is just freed.
+  for (Bucket *i = buckets_; i != buckets_ + bucket_count_; ++i) {
+    new (i) Bucket();
+  }
+  HugeMalloc(max_size_ * sizeof(StringPiece), false, string_mem_);
+  strings_ = static_cast<StringPiece*>(string_mem_.get());
+  strings_[kUNK] = StringPiece("<unk>");
+  for (std::size_t i = 0; i < threads; ++i) {
+    arenas_.push_back();
+  }
+}
+
+template <class HashT> typename GenericConcurrentVocab<HashT>::ID GenericConcurrentVocab<HashT>::WaitForID(const Bucket &bucket) const {
+  ID ret;
+  while (!(ret = bucket.id.load(boost::memory_order_acquire))) {
+    boost::this_thread::yield();
+  }
+  UTIL_THROW_IF(ret == kFull, ProbingSizeException, "Concurrent vocabulary with room for " << (max_size_ - 1) << " words is full.");
+  return ret;
+}
+
+template <class HashT> typename GenericConcurrentVocab<HashT>::ID GenericConcurrentVocab<HashT>::Find(const StringPiece &str) const {
+  uint64_t key = MutableVocabKey<HashT>(str);
+  const Bucket *end = buckets_ + bucket_count_;
+  for (const Bucket *i = Ideal(key);;) {
+    uint64_t got = i->key.load(boost::memory_order_acquire);
+    // An ID still being inserted reads as 0, which is kUNK.
+    if (got == key) {
+      ID id = i->id.load(boost::memory_order_acquire);
+      return id == kFull ? kUNK : id;
+    }
+    if (!got) return kUNK;
+    if (++i == end) i = buckets_;
+  }
+}
+
+template <class HashT> typename GenericConcurrentVocab<HashT>::ID GenericConcurrentVocab<HashT>::FindOrInsert(const StringPiece &str, std::size_t thread) {
+  uint64_t key = MutableVocabKey<HashT>(str);
+  Bucket *end = buckets_ + bucket_count_;
+  for (Bucket *i = Ideal(key);;) {
+    uint64_t got = i->key.load(boost::memory_order_acquire);
+    if (got == key) return WaitForID(*i);
+    if (!got) {
+      // Once an insert has overflowed, don't claim any more buckets.
+      UTIL_THROW_IF(next_.load(boost::memory_order_relaxed) > max_size_, ProbingSizeException, "Concurrent vocabulary with room for " << (max_size_ - 1) << " words is full.");
+      // On failure, got is the key another thread put here.
+      if (i->key.compare_exchange_strong(got, key, boost::memory_order_acq_rel, boost::memory_order_acquire)) {
+        ID id = next_.fetch_add(1, boost::memory_order_relaxed);
+        if (id >= max_size_) {
+          // Wake threads waiting for this key so they throw too.
+          i->id.store(kFull, boost::memory_order_release);
+          UTIL_THROW(ProbingSizeException, "Concurrent vocabulary with room for " << (max_size_ - 1) << " words is full.");
+        }
+        char *copied = static_cast<char*>(arenas_[thread].pool.Allocate(str.size()));
+        std::memcpy(copied, str.data(), str.size());
+        strings_[id] = StringPiece(copied, str.size());
+        i->id.store(id, boost::memory_order_release);
+        return id;
+      }
+      if (got == key) return WaitForID(*i);
+    }
+    if (++i == end) i = buckets_;
+  }
+}
+
+namespace {
+struct StringOrder {
+  bool operator()(const std::pair<StringPiece, uint32_t> &a, const std::pair<StringPiece, uint32_t> &b) const {
+    return a.first < b.first;
+  }
+};
+} // namespace
+
+template <class HashT> void GenericConcurrentVocab<HashT>::Renumber(std::vector<ID> &old_to_new) {
+  std::size_t size = Size();
+  std::vector<std::pair<StringPiece, ID> > sorted;
+  sorted.reserve(size - 1);
+  for (ID i = 1; i < size; ++i) {
+    sorted.push_back(std::make_pair(strings_[i], i));
+  }
+  std::sort(sorted.begin(), sorted.end(), StringOrder());
+  old_to_new.resize(size);
+  old_to_new[kUNK] = kUNK;
+  for (std::size_t i = 0; i < sorted.size(); ++i) {
+    old_to_new[sorted[i].second] = i + 1;
+    strings_[i + 1] = sorted[i].first;
+  }
+  for (Bucket *i = buckets_; i != buckets_ + bucket_count_; ++i) {
+    if (i->key.load(boost::memory_order_relaxed)) {
+      i->id.store(old_to_new[i->id.load(boost::memory_order_relaxed)], boost::memory_order_relaxed);
+    }
+  }
+}
+
+template class GenericConcurrentVocab<MurmurHasher>;
+template class GenericConcurrentVocab<FastHasher>;
+
+} // namespace util
@@ -0,0 +1,115 @@
+#ifndef UTIL_CONCURRENT_VOCAB__
+#define UTIL_CONCURRENT_VOCAB__
+
+/* Vocabulary that several threads can add to at once.  Lookups and inserts go
+ * to one shared linear probing table without locks: a thread claims an empty
+ * bucket by compare-and-swap on its key, copies the string into its own
+ * arena, takes the next ID from an atomic counter, and then publishes the ID
+ * in the bucket.  A thread that finds the key before the ID is published
+ * waits for it.
+ *
+ * IDs depend on how the threads interleave.  Call Renumber after the threads
+ * are done to get IDs that only depend on the set of strings.
+ */
+
+#include "util/fast_hash.hh"
+#include "util/fixed_array.hh"
+#include "util/mmap.hh"
+#include "util/mutable_vocab.hh"
+#include "util/pool.hh"
+#include "util/string_piece.hh"
+
+#include <boost/atomic.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include <stdint.h>
+
+namespace util {
+
+template <class HashT = MurmurHasher> class GenericConcurrentVocab {
+  public:
+    typedef uint32_t ID;
+
+    static const ID kUNK = 0;
+
+    /* Holds up to max_words strings in addition to <unk>; inserting more
+     * throws ProbingSizeException, after which the vocabulary should only be
+     * destroyed.  threads is how many threads will insert,
+     * each passing its own index in [0, threads) to FindOrInsert.
+     */
+    GenericConcurrentVocab(std::size_t max_words, std::size_t threads);
+
+    ID Find(const StringPiece &str) const;
+
+    // thread picks the arena that holds a copy of str.  At most one thread
+    // may use each index at a time.
+    ID FindOrInsert(const StringPiece &str, std::size_t thread);
+
+    // Valid for IDs returned to this thread, or for any ID once the inserting
+    // threads have been joined.
+    StringPiece String(ID id) const {
+      return strings_[id];
+    }
+
+    // Includes kUNK.
+    std::size_t Size() const { return std::min<std::size_t>(next_.load(boost::memory_order_acquire), max_size_); }
+
+    /* Sort the strings bytewise and assign IDs in that order, keeping kUNK as
+     * 0.  old_to_new[old ID] is the new ID, for remapping anything counted
+     * with the old IDs.  No thread may insert while this runs.
+     */
+    void Renumber(std::vector<ID> &old_to_new);
+
+  private:
+    struct Bucket {
+      Bucket() : key(0), id(0) {}
+
+      // 0 is empty.
+      boost::atomic<uint64_t> key;
+      // 0 until the inserting thread has stored the string.  kFull if the
+      // vocabulary was full.
+      boost::atomic<ID> id;
+    };
+
+    static const ID kFull = static_cast<ID>(-1);
+
+    Bucket *Ideal(uint64_t key) const {
+      return buckets_ + key % bucket_count_;
+    }
+
+    ID WaitForID(const Bucket &bucket) const;
+
+    // One per thread, padded so threads don't share a cache line.
+    struct Arena {
+      Pool pool;
+      char padding[64];
+    };
+
+    std::size_t max_size_;
+
+    scoped_memory bucket_mem_;
+    Bucket *buckets_;
+    std::size_t bucket_count_;
+
+    // Indexed by ID.
+    scoped_memory string_mem_;
+    StringPiece *strings_;
+
+    char padding_before_[64];
+    boost::atomic<ID> next_;
+    char padding_after_[64];
+
+    FixedArray<Arena> arenas_;
+
+    // no copying
+    GenericConcurrentVocab(const GenericConcurrentVocab &);
+    GenericConcurrentVocab &operator=(const GenericConcurrentVocab &);
+};
+
+typedef GenericConcurrentVocab<MurmurHasher> ConcurrentVocab;
+typedef GenericConcurrentVocab<FastHasher> FastConcurrentVocab;
+
+} // namespace util
+#endif // UTIL_CONCURRENT_VOCAB__
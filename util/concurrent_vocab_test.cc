@@ -0,0 +1,106 @@
+#include "util/concurrent_vocab.hh"
+
+#include "util/probing_hash_table.hh"
+
+#define BOOST_LEXICAL_CAST_ASSUME_C_LOCALE
+#include <boost/lexical_cast.hpp>
+#include <boost/bind.hpp>
+#include <boost/thread/thread.hpp>
+
+#define BOOST_TEST_MODULE ConcurrentVocabTest
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace util {
+namespace {
+
+template <class Vocab> void Small() {
+  Vocab vocab(10, 1);
+  BOOST_CHECK_EQUAL(1, vocab.FindOrInsert("Foo", 0));
+  BOOST_CHECK_EQUAL(1, vocab.FindOrInsert("Foo", 0));
+  BOOST_CHECK_EQUAL(2, vocab.Size());
+  BOOST_CHECK_EQUAL(1, vocab.Find("Foo"));
+  BOOST_CHECK_EQUAL("Foo", vocab.String(1));
+  BOOST_CHECK_EQUAL(Vocab::kUNK, vocab.Find("Bar"));
+  BOOST_CHECK_EQUAL(2, vocab.FindOrInsert("", 0));
+  BOOST_CHECK_EQUAL(2, vocab.Find(""));
+}
+
+BOOST_AUTO_TEST_CASE(small) {
+  Small<ConcurrentVocab>();
+  Small<FastConcurrentVocab>();
+}
+
+BOOST_AUTO_TEST_CASE(full) {
+  ConcurrentVocab vocab(2, 1);
+  vocab.FindOrInsert("a", 0);
+  vocab.FindOrInsert("b", 0);
+  BOOST_CHECK_EQUAL(2, vocab.FindOrInsert("b", 0));
+  BOOST_CHECK_THROW(vocab.FindOrInsert("c", 0), ProbingSizeException);
+}
+
+const unsigned kWords = 20000;
+const unsigned kThreads = 4;
+
+// Every thread inserts every word, starting at a different place.
+void Insert(ConcurrentVocab *vocab, unsigned thread, std::vector<ConcurrentVocab::ID> *ids) {
+  ids->resize(kWords);
+  for (unsigned i = 0; i < kWords; ++i) {
+    unsigned word = (i + thread * kWords / kThreads) % kWords;
+    (*ids)[word] = vocab->FindOrInsert(boost::lexical_cast<std::string>(word), thread);
+  }
+}
+
+void InsertThreads(ConcurrentVocab &vocab, std::vector<ConcurrentVocab::ID> &renumbered) {
+  std::vector<std::vector<ConcurrentVocab::ID> > ids(kThreads);
+  boost::thread_group threads;
+  for (unsigned t = 0; t < kThreads; ++t) {
+    threads.create_thread(boost::bind(&Insert, &vocab, t, &ids[t]));
+  }
+  threads.join_all();
+
+  BOOST_REQUIRE_EQUAL(kWords + 1, vocab.Size());
+  std::vector<bool> seen(kWords + 1);
+  for (unsigned word = 0; word < kWords; ++word) {
+    ConcurrentVocab::ID id = ids[0][word];
+    for (unsigned t = 1; t < kThreads; ++t) {
+      BOOST_REQUIRE_EQUAL(id, ids[t][word]);
+    }
+    BOOST_REQUIRE(id > 0 && id <= kWords);
+    BOOST_REQUIRE(!seen[id]);
+    seen[id] = true;
+    BOOST_REQUIRE_EQUAL(boost::lexical_cast<std::string>(word), vocab.String(id));
+  }
+
+  std::vector<ConcurrentVocab::ID> old_to_new;
+  vocab.Renumber(old_to_new);
+  renumbered.resize(kWords);
+  for (unsigned word = 0; word < kWords; ++word) {
+    std::string str(boost::lexical_cast<std::string>(word));
+    renumbered[word] = vocab.Find(str);
+    BOOST_REQUIRE_EQUAL(old_to_new[ids[0][word]], renumbered[word]);
+    BOOST_REQUIRE_EQUAL(str, vocab.String(renumbered[word]));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(threads) {
+  std::vector<ConcurrentVocab::ID> first, second;
+  {
+    ConcurrentVocab vocab(kWords, kThreads);
+    InsertThreads(vocab, first);
+    for (ConcurrentVocab::ID i = 2; i < vocab.Size(); ++i) {
+      BOOST_REQUIRE(vocab.String(i - 1) < vocab.String(i));
+    }
+  }
+  {
+    ConcurrentVocab vocab(kWords, kThreads);
+    InsertThreads(vocab, second);
+  }
+  BOOST_CHECK(first == second);
+}
+
+} // namespace
+} // namespace util
@@ -8,12 +8,10 @@
 #include "util/double-conversion/double-conversion.h"
 #include "util/double-conversion/utils.h"
 #include "util/file.hh"
+#include "util/integer_to_string.hh"
 #include "util/scoped.hh"
 #include "util/string_piece.hh"
 
-#define BOOST_LEXICAL_CAST_ASSUME_C_LOCALE
-#include <boost/lexical_cast.hpp>
-
 namespace util {
 class FakeOFStream {
   public:
@@ -55,9 +53,12 @@ class FakeOFStream {
       return *this;
     }
 
-    // Inefficient!  TODO: more efficient implementation
-    FakeOFStream &operator<<(unsigned value) {
-      return *this << boost::lexical_cast<std::string>(value);
+    FakeOFStream &operator<<(uint32_t value) {
+      return Integer(value);
+    }
+
+    FakeOFStream &operator<<(uint64_t value) {
+      return Integer(value);
     }
 
     FakeOFStream &operator<<(char c) {
@@ -82,6 +83,14 @@ class FakeOFStream {
     }
 
   private:
+    template <class T> FakeOFStream &Integer(T value) {
+      char buf[ToStringBuf<T>::kBytes];
+      char *end = ToString(value, buf);
+      EnsureRemaining(end - buf);
+      builder_.AddSubstring(buf, end - buf);
+      return *this;
+    }
+
     void EnsureRemaining(std::size_t amount) {
       if (static_cast<std::size_t>(builder_.size() - builder_.position()) <= amount) {
         Flush();
@@ -0,0 +1,252 @@
+#include "util/fast_hash.hh"
+
+#include <string.h>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define UTIL_FAST_HASH_AVX2
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define UTIL_FAST_HASH_NOINLINE __attribute__((noinline))
+#else
+#define UTIL_FAST_HASH_NOINLINE
+#endif
+
+namespace util {
+
+namespace {
+
+// wyhash's default secret.
+const uint64_t kWy[4] = {0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL};
+
+// Keys for the long path, from splitmix64.  Stripe s of a block uses
+// kStripeKey[s..s+7] and blocks are scrambled with kStripeKey[16..23].
+const uint64_t kStripeKey[24] = {
+  0x95ad0fa506962724ULL, 0xe5bc8d0dc754b260ULL, 0xe0257c3494e95e34ULL,
+  0x966f0078075fa446ULL, 0xf5ef1861cd4957abULL, 0x388c861106107b74ULL,
+  0x4f5bb23e352d9f8dULL, 0x9acb9306db279e85ULL, 0x25bf78dd5d05b550ULL,
+  0x7e649d3971ef745fULL, 0x719ac066bb4c7fc6ULL, 0x6015e6b13f4a277dULL,
+  0x3729d4fec6437c45ULL, 0xadfec266680d1d52ULL, 0x56f50c087950759fULL,
+  0x8c545f1e5612ece3ULL, 0xed2a75911f96addaULL, 0x244d89c1b33b5507ULL,
+  0xcfd997825abd723dULL, 0x479da45f57f336a1ULL, 0x4916c2e6edf9bdfaULL,
+  0xb378750ab4d899f4ULL, 0xf338584250df8335ULL, 0xf6e8b423bf488729ULL,
+};
+
+// XXH3's initial accumulators.
+const uint64_t kInitAcc[8] = {
+  0xC2B2AE3DULL, 0x9E3779B185EBCA87ULL, 0xC2B2AE3D27D4EB4FULL, 0x165667B19E3779F9ULL,
+  0x85EBCA77C2B2AE63ULL, 0x85EBCA77ULL, 0x27D4EB2F165667C5ULL, 0x9E3779B1ULL
+};
+
+const uint64_t kScramblePrime = 0x9E3779B1ULL;
+
+const std::size_t kStripe = 64;
+const std::size_t kStripesPerBlock = 16;
+const std::size_t kBlock = kStripe * kStripesPerBlock;
+// Longer input takes the striped path.
+const std::size_t kShortMax = 256;
+
+inline uint64_t Read8(const uint8_t *p) {
+  uint64_t ret;
+  memcpy(&ret, p, 8);
+  return ret;
+}
+
+inline uint64_t Read4(const uint8_t *p) {
+  uint32_t ret;
+  memcpy(&ret, p, 4);
+  return ret;
+}
+
+// 64x64 -> 128 bit multiply, returning low and high halves in a and b.
+inline void Multiply(uint64_t &a, uint64_t &b) {
+#if defined(__SIZEOF_INT128__)
+  __uint128_t r = a;
+  r *= b;
+  a = static_cast<uint64_t>(r);
+  b = static_cast<uint64_t>(r >> 64);
+#else
+  uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<uint32_t>(a), lb = static_cast<uint32_t>(b);
+  uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32);
+  uint64_t c = t < rl;
+  uint64_t lo = t + (rm1 << 32);
+  c += lo < t;
+  uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+  a = lo;
+  b = hi;
+#endif
+}
+
+inline uint64_t Mix(uint64_t a, uint64_t b) {
+  Multiply(a, b);
+  return a ^ b;
+}
+
+// One 64-byte stripe into eight lanes.  Lanes are paired so the AVX2 version
+// can swap within 128-bit halves.
+inline void AccumulateStripe(uint64_t *acc, const uint8_t *in, const uint64_t *key) {
+  for (unsigned i = 0; i < 8; ++i) {
+    uint64_t data = Read8(in + 8 * i);
+    uint64_t keyed = data ^ key[i];
+    acc[i ^ 1] += data;
+    acc[i] += (keyed & 0xffffffffULL) * (keyed >> 32);
+  }
+}
+
+void AccumulatePortable(uint64_t *acc, const uint8_t *in, const uint64_t *key, std::size_t stripes) {
+  for (std::size_t s = 0; s < stripes; ++s) {
+    AccumulateStripe(acc, in + s * kStripe, key + s);
+  }
+}
+
+void ScramblePortable(uint64_t *acc, const uint64_t *key) {
+  for (unsigned i = 0; i < 8; ++i) {
+    acc[i] = (acc[i] ^ (acc[i] >> 47) ^ key[i]) * kScramblePrime;
+  }
+}
+
+#ifdef UTIL_FAST_HASH_AVX2
+__attribute__((target("avx2"))) void AccumulateAVX2(uint64_t *acc, const uint8_t *in, const uint64_t *key, std::size_t stripes) {
+  __m256i a0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc));
+  __m256i a1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc + 4));
+  for (std::size_t s = 0; s < stripes; ++s) {
+    const uint8_t *stripe = in + s * kStripe;
+    __m256i d0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(stripe));
+    __m256i d1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(stripe + 32));
+    __m256i k0 = _mm256_xor_si256(d0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key + s)));
+    __m256i k1 = _mm256_xor_si256(d1, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key + s + 4)));
+    // Low 32 bits times high 32 bits of each lane.
+    __m256i p0 = _mm256_mul_epu32(k0, _mm256_srli_epi64(k0, 32));
+    __m256i p1 = _mm256_mul_epu32(k1, _mm256_srli_epi64(k1, 32));
+    // Data goes to the other lane of each pair.
+    a0 = _mm256_add_epi64(a0, _mm256_add_epi64(p0, _mm256_shuffle_epi32(d0, _MM_SHUFFLE(1, 0, 3, 2))));
+    a1 = _mm256_add_epi64(a1, _mm256_add_epi64(p1, _mm256_shuffle_epi32(d1, _MM_SHUFFLE(1, 0, 3, 2))));
+  }
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc), a0);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc + 4), a1);
+}
+
+__attribute__((target("avx2"))) void ScrambleAVX2(uint64_t *acc, const uint64_t *key) {
+  const __m256i prime = _mm256_set1_epi32(static_cast<int>(kScramblePrime));
+  for (unsigned i = 0; i < 8; i += 4) {
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc + i));
+    a = _mm256_xor_si256(a, _mm256_srli_epi64(a, 47));
+    a = _mm256_xor_si256(a, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key + i)));
+    // 64 x 32 bit multiply from two 32 x 32 bit multiplies.
+    __m256i low = _mm256_mul_epu32(a, prime);
+    __m256i high = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), prime);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc + i), _mm256_add_epi64(low, _mm256_slli_epi64(high, 32)));
+  }
+}
+#endif
+
+typedef void (*AccumulateFunction)(uint64_t *acc, const uint8_t *in, const uint64_t *key, std::size_t stripes);
+typedef void (*ScrambleFunction)(uint64_t *acc, const uint64_t *key);
+
+// What the seed becomes when it is 0, the common case.
+const uint64_t kZeroSeed = 0xca813bf4c7abf0a9ULL;
+
+uint64_t HashShort(const uint8_t *p, std::size_t len, uint64_t seed) {
+  seed = seed ? seed ^ Mix(seed ^ kWy[0], kWy[1]) : kZeroSeed;
+  uint64_t a, b;
+  if (len <= 16) {
+    if (len >= 4) {
+      a = (Read4(p) << 32) | Read4(p + ((len >> 3) << 2));
+      b = (Read4(p + len - 4) << 32) | Read4(p + len - 4 - ((len >> 3) << 2));
+    } else if (len > 0) {
+      a = (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[len >> 1]) << 8) | p[len - 1];
+      b = 0;
+    } else {
+      a = b = 0;
+    }
+  } else {
+    std::size_t i = len;
+    if (i > 48) {
+      uint64_t see1 = seed, see2 = seed;
+      do {
+        seed = Mix(Read8(p) ^ kWy[1], Read8(p + 8) ^ seed);
+        see1 = Mix(Read8(p + 16) ^ kWy[2], Read8(p + 24) ^ see1);
+        see2 = Mix(Read8(p + 32) ^ kWy[3], Read8(p + 40) ^ see2);
+        p += 48;
+        i -= 48;
+      } while (i > 48);
+      seed ^= see1 ^ see2;
+    }
+    while (i > 16) {
+      seed = Mix(Read8(p) ^ kWy[1], Read8(p + 8) ^ seed);
+      i -= 16;
+      p += 16;
+    }
+    a = Read8(p + i - 16);
+    b = Read8(p + i - 8);
+  }
+  a ^= kWy[1];
+  b ^= seed;
+  Multiply(a, b);
+  return Mix(a ^ kWy[0] ^ len, b ^ kWy[1]);
+}
+
+// Not inlined so FastHash of short input doesn't set up its stack frame.
+UTIL_FAST_HASH_NOINLINE uint64_t HashLong(const uint8_t *p, std::size_t len, uint64_t seed, AccumulateFunction accumulate, ScrambleFunction scramble) {
+  uint64_t acc[8];
+  for (unsigned i = 0; i < 8; ++i) acc[i] = kInitAcc[i] ^ seed;
+  // The last stripe is always done separately, even if it is whole.
+  const std::size_t blocks = (len - 1) / kBlock;
+  for (std::size_t b = 0; b < blocks; ++b) {
+    accumulate(acc, p + b * kBlock, kStripeKey, kStripesPerBlock);
+    scramble(acc, kStripeKey + 16);
+  }
+  const std::size_t stripes = ((len - 1) - blocks * kBlock) / kStripe;
+  accumulate(acc, p + blocks * kBlock, kStripeKey, stripes);
+  AccumulateStripe(acc, p + len - kStripe, kStripeKey + 15);
+
+  uint64_t h = Mix(seed ^ kWy[0], len ^ kWy[1]);
+  for (unsigned i = 0; i < 4; ++i) {
+    h = Mix(acc[2 * i] ^ kStripeKey[i], acc[2 * i + 1] ^ h);
+  }
+  return Mix(h ^ kWy[0], len ^ kWy[3]);
+}
+
+struct Dispatch {
+  Dispatch() : accumulate(&AccumulatePortable), scramble(&ScramblePortable), avx2(false) {
+#ifdef UTIL_FAST_HASH_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+      accumulate = &AccumulateAVX2;
+      scramble = &ScrambleAVX2;
+      avx2 = true;
+    }
+#endif
+  }
+
+  AccumulateFunction accumulate;
+  ScrambleFunction scramble;
+  bool avx2;
+};
+
+const Dispatch &GetDispatch() {
+  static const Dispatch dispatch;
+  return dispatch;
+}
+
+} // namespace
+
+uint64_t FastHash(const void *key, std::size_t len, uint64_t seed) {
+  const uint8_t *p = static_cast<const uint8_t*>(key);
+  if (len <= kShortMax) return HashShort(p, len, seed);
+  const Dispatch &dispatch = GetDispatch();
+  return HashLong(p, len, seed, dispatch.accumulate, dispatch.scramble);
+}
+
+uint64_t FastHashPortable(const void *key, std::size_t len, uint64_t seed) {
+  const uint8_t *p = static_cast<const uint8_t*>(key);
+  if (len <= kShortMax) return HashShort(p, len, seed);
+  return HashLong(p, len, seed, &AccumulatePortable, &ScramblePortable);
+}
+
+bool FastHashUsesAVX2() {
+  return GetDispatch().avx2;
+}
+
+} // namespace util
@@ -0,0 +1,58 @@
+#include "util/fast_hash.hh"
+
+#define BOOST_TEST_MODULE FastHashTest
+#include <boost/test/unit_test.hpp>
+
+#include <set>
+#include <vector>
+
+namespace util {
+namespace {
+
+std::vector<unsigned char> RandomBytes(std::size_t length) {
+  std::vector<unsigned char> ret(length);
+  uint64_t state = 0x853c49e6748fea9bULL;
+  for (std::size_t i = 0; i < length; ++i) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    ret[i] = static_cast<unsigned char>(state >> 56);
+  }
+  return ret;
+}
+
+// Whichever path the CPU picked must give the portable values.
+BOOST_AUTO_TEST_CASE(Dispatch) {
+  BOOST_TEST_MESSAGE("AVX2: " << FastHashUsesAVX2());
+  std::vector<unsigned char> data(RandomBytes(5000));
+  for (std::size_t length = 0; length <= 2200; ++length) {
+    BOOST_REQUIRE_EQUAL(FastHashPortable(&data[0], length), FastHash(&data[0], length));
+    BOOST_REQUIRE_EQUAL(FastHashPortable(&data[1], length, length), FastHash(&data[1], length, length));
+  }
+  BOOST_CHECK_EQUAL(FastHashPortable(&data[0], 5000, 7), FastHash(&data[0], 5000, 7));
+}
+
+// Every length, seed, and single byte change should give a new value.
+BOOST_AUTO_TEST_CASE(Distinct) {
+  std::vector<unsigned char> data(RandomBytes(1100));
+  std::set<uint64_t> seen;
+  for (std::size_t length = 0; length <= data.size(); ++length) {
+    BOOST_REQUIRE(seen.insert(FastHash(&data[0], length)).second);
+    BOOST_REQUIRE(seen.insert(FastHash(&data[0], length, 1)).second);
+  }
+  const std::size_t kLengths[] = {1, 3, 4, 8, 16, 17, 48, 49, 100, 256, 257, 1024, 1025, 1100};
+  for (std::size_t l = 0; l < sizeof(kLengths) / sizeof(std::size_t); ++l) {
+    for (std::size_t i = 0; i < kLengths[l]; ++i) {
+      data[i] ^= 1;
+      BOOST_REQUIRE(seen.insert(FastHash(&data[0], kLengths[l])).second);
+      data[i] ^= 1;
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Functors) {
+  const char *str = "foo bar";
+  BOOST_CHECK_EQUAL(MurmurHashNative(str, 7, 3), MurmurHasher()(str, 7, 3));
+  BOOST_CHECK_EQUAL(FastHash(str, 7, 3), FastHasher()(str, 7, 3));
+}
+
+} // namespace
+} // namespace util
@@ -0,0 +1,121 @@
+#include "util/fingerprint_set.hh"
+
+#include "util/exception.hh"
+#include "util/probing_hash_table.hh"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace util {
+
+namespace {
+// Fraction of slots used before doubling.
+const float kMaxLoad = 0.9;
+
+uint32_t MaskFor(unsigned remainder_bits) {
+  return static_cast<uint32_t>(~static_cast<uint64_t>(0) << (32 - remainder_bits));
+}
+} // namespace
+
+FingerprintSet::FingerprintSet(unsigned fingerprint_bits, std::size_t expected_entries)
+  : fingerprint_bits_(fingerprint_bits), log_buckets_(fingerprint_bits - 32), entries_(0) {
+  UTIL_THROW_IF(fingerprint_bits < 40 || fingerprint_bits > 56, Exception, "Fingerprint bits must be between 40 and 56, not " << fingerprint_bits);
+  while (static_cast<float>(expected_entries) > kMaxLoad * static_cast<float>((static_cast<std::size_t>(1) << log_buckets_) * kSlots) && fingerprint_bits_ - log_buckets_ > kMinRemainder) {
+    ++log_buckets_;
+  }
+  remainder_mask_ = MaskFor(fingerprint_bits_ - log_buckets_);
+  std::size_t buckets = (static_cast<std::size_t>(1) << log_buckets_) + kMaxDisplacement;
+  threshold_ = static_cast<std::size_t>(kMaxLoad * static_cast<float>((static_cast<std::size_t>(1) << log_buckets_) * kSlots));
+  // Zeroed buckets are empty.
+  HugeMalloc(buckets * sizeof(Bucket), true, mem_);
+}
+
+bool FingerprintSet::Find(uint64_t hash) const {
+  uint64_t home = Home(hash);
+  uint32_t remainder = Remainder(hash);
+  const Bucket *bucket = Buckets() + home;
+  for (unsigned displacement = 0; displacement <= kMaxDisplacement; ++displacement, ++bucket) {
+    unsigned count = bucket->Count();
+    for (unsigned slot = 0; slot < count; ++slot) {
+      if (bucket->remainder[slot] == remainder && bucket->Displacement(slot) == displacement) return true;
+    }
+    if (count < kSlots) return false;
+  }
+  Stash::ConstIterator it;
+  return stash_.Find(StashKey(home, remainder), it);
+}
+
+void FingerprintSet::Place(uint64_t home, uint32_t remainder) {
+  Bucket *bucket = Buckets() + home;
+  for (unsigned displacement = 0; displacement <= kMaxDisplacement; ++displacement, ++bucket) {
+    if (bucket->Count() < kSlots) {
+      bucket->Append(remainder, displacement);
+      return;
+    }
+  }
+  StashEntry entry;
+  entry.key = StashKey(home, remainder);
+  stash_.Insert(entry);
+  stash_keys_.push_back(entry.key);
+}
+
+/* Entry in old bucket j with displacement d has old home h = j - d and goes
+ * to new home 2h or 2h + 1.  Old buckets are processed from the top down so
+ * entries only land in buckets that were already processed: for j >= 32 the
+ * new home is at least 2(j - 15) > j.  The first 32 old buckets are emptied
+ * into a buffer up front and placed at the end, like ProbingHashTable::Double
+ * does with roll-over entries.  Since nothing is placed below a bucket that is
+ * cleared later, each entry still sits in the first bucket with room after
+ * its home, which is what lookup relies on.  Stashed entries are placed last
+ * because there may be room for them now.
+ */
+void FingerprintSet::Double() {
+  if (fingerprint_bits_ - log_buckets_ - 1 < kMinRemainder) {
+    // Out of remainder bits.  Keep going, but the stash will take over.
+    threshold_ = std::numeric_limits<std::size_t>::max();
+    return;
+  }
+  const std::size_t old_buckets = (static_cast<std::size_t>(1) << log_buckets_) + kMaxDisplacement;
+  ++log_buckets_;
+  remainder_mask_ = MaskFor(fingerprint_bits_ - log_buckets_);
+  const std::size_t new_buckets = (static_cast<std::size_t>(1) << log_buckets_) + kMaxDisplacement;
+  HugeRealloc(new_buckets * sizeof(Bucket), true, mem_);
+  threshold_ = static_cast<std::size_t>(kMaxLoad * static_cast<float>((static_cast<std::size_t>(1) << log_buckets_) * kSlots));
+
+  std::vector<uint64_t> stashed;
+  stashed.swap(stash_keys_);
+  stash_.Clear();
+
+  Bucket *buckets = Buckets();
+  std::vector<std::pair<uint64_t, uint32_t> > low;
+  const std::size_t low_end = std::min<std::size_t>(2 * kMaxDisplacement + 2, old_buckets);
+  Bucket copy;
+  for (std::size_t j = 0; j < low_end; ++j) {
+    copy = buckets[j];
+    buckets[j].meta = 0;
+    for (unsigned slot = 0; slot < copy.Count(); ++slot) {
+      uint64_t home = j - copy.Displacement(slot);
+      uint32_t remainder = copy.remainder[slot];
+      low.push_back(std::make_pair(2 * home + (remainder >> 31), remainder << 1));
+    }
+  }
+  for (std::size_t j = old_buckets; j-- > low_end;) {
+    copy = buckets[j];
+    buckets[j].meta = 0;
+    for (unsigned slot = 0; slot < copy.Count(); ++slot) {
+      uint64_t home = j - copy.Displacement(slot);
+      uint32_t remainder = copy.remainder[slot];
+      Place(2 * home + (remainder >> 31), remainder << 1);
+    }
+  }
+  for (std::vector<std::pair<uint64_t, uint32_t> >::const_iterator i = low.begin(); i != low.end(); ++i) {
+    Place(i->first, i->second);
+  }
+  for (std::vector<uint64_t>::const_iterator i = stashed.begin(); i != stashed.end(); ++i) {
+    PlaceStash(*i);
+  }
+}
+
+} // namespace util
@@ -0,0 +1,161 @@
+#ifndef UTIL_FINGERPRINT_SET_H
+#define UTIL_FINGERPRINT_SET_H
+
+#include "util/mmap.hh"
+#include "util/probing_hash_table.hh"
+
+#include <cstddef>
+#include <vector>
+
+#include <stdint.h>
+
+namespace util {
+
+/* Set of 64-bit hashes that stores only a 32-bit remainder per entry.
+ *
+ * A hash is identified by its top FingerprintBits() bits: the top bits pick a
+ * home bucket (the quotient) and the next bits are stored (the remainder).
+ * Two different hashes that agree in those bits are treated as the same, so
+ * FindOrInsert reports a new hash as present with probability about
+ * Size() / 2^FingerprintBits().
+ *
+ * Buckets are 32 bytes: 7 remainders and a word with the count and each
+ * entry's displacement (0-15 buckets) from its home.  The rare entry that
+ * finds no room that close to home goes to a small stash of full keys.
+ * Doubling moves one bit from each remainder into the quotient, so the
+ * identifying bits stay the same.  The memory is grown with HugeRealloc
+ * (mremap on Linux, no copy) and rehashed in place.
+ */
+class FingerprintSet {
+  public:
+    /* fingerprint_bits is between 40 and 56.  The initial table has at least
+     * 2^(fingerprint_bits - 32) buckets of 7 entries, more if needed to hold
+     * expected_entries without doubling.
+     */
+    explicit FingerprintSet(unsigned fingerprint_bits = 48, std::size_t expected_entries = 0);
+
+    // Return true if the hash was found (and not inserted), like
+    // ProbingHashTable::FindOrInsert.
+    bool FindOrInsert(uint64_t hash) {
+      if (entries_ >= threshold_) Double();
+      uint64_t home = Home(hash);
+      uint32_t remainder = Remainder(hash);
+      Bucket *bucket = Buckets() + home;
+      for (unsigned displacement = 0; displacement <= kMaxDisplacement; ++displacement, ++bucket) {
+        unsigned count = bucket->Count();
+        for (unsigned slot = 0; slot < count; ++slot) {
+          if (bucket->remainder[slot] == remainder && bucket->Displacement(slot) == displacement) return true;
+        }
+        if (count < kSlots) {
+          // No deletion, so an entry with this home can't be further along.
+          bucket->Append(remainder, displacement);
+          ++entries_;
+          return false;
+        }
+      }
+      StashEntry entry;
+      entry.key = StashKey(home, remainder);
+      Stash::MutableIterator it;
+      if (stash_.FindOrInsert(entry, it)) return true;
+      stash_keys_.push_back(entry.key);
+      ++entries_;
+      return false;
+    }
+
+    bool Find(uint64_t hash) const;
+
+    // Hint that hash will be looked up soon.
+    void Prefetch(uint64_t hash) const {
+      UTIL_PREFETCH(Buckets() + Home(hash));
+    }
+
+    // FindOrInsert each hash in order after prefetching them all.
+    void FindOrInsertBatch(const uint64_t *hashes, std::size_t count, bool *found) {
+      for (std::size_t i = 0; i < count; ++i) Prefetch(hashes[i]);
+      for (std::size_t i = 0; i < count; ++i) found[i] = FindOrInsert(hashes[i]);
+    }
+
+    std::size_t Size() const { return entries_; }
+
+    unsigned FingerprintBits() const { return fingerprint_bits_; }
+
+    // Bytes held by the buckets and the stash.
+    std::size_t MemoryUsage() const {
+      return mem_.size() + stash_.MemoryUsage() + stash_keys_.capacity() * sizeof(uint64_t);
+    }
+
+    // Entries that did not fit near their home.
+    std::size_t StashSize() const { return stash_.Size(); }
+
+  private:
+    static const unsigned kSlots = 7;
+    static const unsigned kMaxDisplacement = 15;
+    // Stop doubling when this few bits would be left in the remainder.
+    static const unsigned kMinRemainder = 8;
+
+    struct Bucket {
+      uint32_t remainder[kSlots];
+      // Bits 0-2: count.  Bits 3 + 4 * slot: displacement of slot.
+      uint32_t meta;
+
+      unsigned Count() const { return meta & 7; }
+      unsigned Displacement(unsigned slot) const { return (meta >> (3 + 4 * slot)) & 15; }
+      void Append(uint32_t remainder_in, unsigned displacement) {
+        unsigned slot = Count();
+        remainder[slot] = remainder_in;
+        meta += 1 + (displacement << (3 + 4 * slot));
+      }
+    };
+
+    struct StashEntry {
+      typedef uint64_t Key;
+      uint64_t key;
+      uint64_t GetKey() const { return key; }
+      void SetKey(uint64_t to) { key = to; }
+    };
+    typedef AutoProbing<StashEntry, IdentityHash> Stash;
+
+    // The identifying bits of a hash, which don't change on doubling.  The
+    // bottom bit is set to stay clear of the invalid key 0.
+    uint64_t StashKey(uint64_t home, uint32_t remainder) const {
+      return (home << (64 - log_buckets_)) | ((static_cast<uint64_t>(remainder) << 32) >> log_buckets_) | 1;
+    }
+
+    Bucket *Buckets() { return static_cast<Bucket*>(mem_.get()); }
+    const Bucket *Buckets() const { return static_cast<const Bucket*>(mem_.get()); }
+
+    uint64_t Home(uint64_t hash) const {
+      return hash >> (64 - log_buckets_);
+    }
+
+    uint32_t Remainder(uint64_t hash) const {
+      return static_cast<uint32_t>((hash << log_buckets_) >> 32) & remainder_mask_;
+    }
+
+    void Double();
+
+    // Used while doubling.  The remainder is already in the new format.
+    void Place(uint64_t home, uint32_t remainder);
+
+    void PlaceStash(uint64_t key) {
+      Place(Home(key), Remainder(key));
+    }
+
+    const unsigned fingerprint_bits_;
+
+    unsigned log_buckets_;
+    uint32_t remainder_mask_;
+
+    std::size_t entries_, threshold_;
+
+    scoped_memory mem_;
+
+    // Stashed entries go back in the table on doubling, since a stashed
+    // entry is only looked for when its buckets are full.
+    Stash stash_;
+    std::vector<uint64_t> stash_keys_;
+};
+
+} // namespace util
+
+#endif // UTIL_FINGERPRINT_SET_H
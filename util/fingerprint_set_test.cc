@@ -0,0 +1,60 @@
+#include "util/fingerprint_set.hh"
+
+#include "util/murmur_hash.hh"
+
+#define BOOST_TEST_MODULE FingerprintSetTest
+#include <boost/test/unit_test.hpp>
+
+namespace util {
+namespace {
+
+uint64_t Hash(uint64_t value) {
+  return MurmurHash64A(&value, sizeof(value));
+}
+
+BOOST_AUTO_TEST_CASE(Simple) {
+  FingerprintSet set(40);
+  BOOST_CHECK(!set.Find(Hash(1)));
+  BOOST_CHECK(!set.FindOrInsert(Hash(1)));
+  BOOST_CHECK(set.Find(Hash(1)));
+  BOOST_CHECK(set.FindOrInsert(Hash(1)));
+  BOOST_CHECK(!set.Find(Hash(2)));
+  BOOST_CHECK_EQUAL(1, set.Size());
+}
+
+// Start small so the table doubles many times.
+BOOST_AUTO_TEST_CASE(Doubling) {
+  FingerprintSet set(40);
+  const uint64_t kCount = 200000;
+  for (uint64_t i = 0; i < kCount; ++i) {
+    BOOST_REQUIRE(!set.FindOrInsert(Hash(i)));
+  }
+  BOOST_CHECK_EQUAL(kCount, set.Size());
+  for (uint64_t i = 0; i < kCount; ++i) {
+    BOOST_REQUIRE(set.Find(Hash(i)));
+    BOOST_REQUIRE(set.FindOrInsert(Hash(i)));
+  }
+  BOOST_CHECK_EQUAL(kCount, set.Size());
+}
+
+// Only the top FingerprintBits() bits matter.
+BOOST_AUTO_TEST_CASE(LowBitsIgnored) {
+  FingerprintSet set(48);
+  uint64_t base = Hash(7);
+  BOOST_CHECK(!set.FindOrInsert(base));
+  BOOST_CHECK(set.Find(base ^ 0xffff));
+  BOOST_CHECK(!set.Find(base ^ (1ULL << 16)));
+}
+
+BOOST_AUTO_TEST_CASE(Expected) {
+  FingerprintSet set(40, 100000);
+  std::size_t memory = set.MemoryUsage();
+  for (uint64_t i = 0; i < 100000; ++i) {
+    set.FindOrInsert(Hash(i));
+  }
+  // Doubling would at least double it; only the stash may grow.
+  BOOST_CHECK_LT(set.MemoryUsage(), 2 * memory);
+}
+
+} // namespace
+} // namespace util
@@ -0,0 +1,387 @@
+#ifndef UTIL_GROUP_PROBING_HASH_TABLE_H
+#define UTIL_GROUP_PROBING_HASH_TABLE_H
+
+#include "util/exception.hh"
+#include "util/have.hh"
+#include "util/probing_hash_table.hh"
+#include "util/scoped.hh"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace util {
+
+namespace detail {
+inline unsigned LowestBit(unsigned mask) {
+#if defined(__GNUC__)
+  return __builtin_ctz(mask);
+#else
+  unsigned ret = 0;
+  for (; !(mask & 1); mask >>= 1) ++ret;
+  return ret;
+#endif
+}
+} // namespace detail
+
+/* Non-standard hash table with the same interface as ProbingHashTable, in the
+ * style of Abseil's SwissTable.  Slots are in groups of 16, each slot with a
+ * control byte: kEmpty or the top 7 bits of the hash.  A lookup starts at the
+ * group picked by the low bits of the hash and compares all 16 control bytes
+ * at once (with SSE2 where available), only comparing keys where the tag
+ * matches.  Groups are probed linearly until one has an empty slot.
+ *
+ * The number of slots is a power of two so there is no division.  The hash
+ * should fill all 64 bits.  Memory holds the entries followed by the control
+ * bytes and is externalized as in ProbingHashTable.  Only insert and lookup.
+ * There is no invalid key; the argument is accepted to be a drop-in.
+ */
+template <class EntryT, class HashT, class EqualT = std::equal_to<typename EntryT::Key> > class GroupProbingHashTable {
+  public:
+    typedef EntryT Entry;
+    typedef typename Entry::Key Key;
+    typedef const Entry *ConstIterator;
+    typedef Entry *MutableIterator;
+    typedef HashT Hash;
+    typedef EqualT Equal;
+
+    static const std::size_t kGroup = 16;
+
+    // Power of two number of slots, at least entries * multiplier.
+    static uint64_t Slots(uint64_t entries, float multiplier) {
+      uint64_t want = std::max(entries + 1, static_cast<uint64_t>(multiplier * static_cast<float>(entries)));
+      uint64_t slots = kGroup;
+      while (slots < want) slots *= 2;
+      return slots;
+    }
+
+    static uint64_t SizeForSlots(uint64_t slots) {
+      return slots * (sizeof(Entry) + 1);
+    }
+
+    static uint64_t Size(uint64_t entries, float multiplier) {
+      return SizeForSlots(Slots(entries, multiplier));
+    }
+
+    // Must be assigned to later.
+    GroupProbingHashTable() : begin_(NULL), ctrl_(NULL), slots_(0), groups_mask_(0), entries_(0) {}
+
+    // allocated must be SizeForSlots of a power of two at least kGroup.
+    GroupProbingHashTable(void *start, std::size_t allocated, const Key & /*invalid*/ = Key(), const Hash &hash_func = Hash(), const Equal &equal_func = Equal())
+      : slots_(allocated / (sizeof(Entry) + 1)),
+        groups_mask_(slots_ / kGroup - 1),
+        hash_(hash_func),
+        equal_(equal_func),
+        entries_(0) {
+      UTIL_THROW_IF(slots_ < kGroup || (slots_ & (slots_ - 1)), Exception, "Group probing needs a power of two slots, not " << slots_);
+      Relocate(start);
+    }
+
+    void Relocate(void *new_base) {
+      begin_ = reinterpret_cast<MutableIterator>(new_base);
+      ctrl_ = reinterpret_cast<uint8_t*>(begin_ + slots_);
+    }
+
+    template <class T> MutableIterator Insert(const T &t) {
+      UTIL_THROW_IF(++entries_ >= slots_, ProbingSizeException, "Hash table with " << slots_ << " slots is full.");
+      return UncheckedInsert(t);
+    }
+
+    // Return true if the value was found (and not inserted).  This is consistent with Find but the opposite if hash_map!
+    template <class T> bool FindOrInsert(const T &t, MutableIterator &out) {
+      std::size_t slot;
+      uint8_t tag;
+      if (Lookup(t.GetKey(), slot, tag)) {
+        out = begin_ + slot;
+        return true;
+      }
+      UTIL_THROW_IF(++entries_ >= slots_, ProbingSizeException, "Hash table with " << slots_ << " slots is full.");
+      ctrl_[slot] = tag;
+      out = begin_ + slot;
+      *out = t;
+      return false;
+    }
+
+    void FinishedInserting() {}
+
+    // Hint that key will be looked up soon.
+    template <class K> void Prefetch(const K key) const {
+      std::size_t base = (static_cast<uint64_t>(hash_(key)) & groups_mask_) * kGroup;
+      UTIL_PREFETCH(ctrl_ + base);
+      UTIL_PREFETCH(begin_ + base);
+    }
+
+    // Like ProbingHashTable::FindBatch.
+    template <class K> void FindBatch(const K *keys, std::size_t count, ConstIterator *out, bool *found) const {
+      for (std::size_t i = 0; i < count; ++i) Prefetch(keys[i]);
+      for (std::size_t i = 0; i < count; ++i) found[i] = Find(keys[i], out[i]);
+    }
+
+    // Like ProbingHashTable::FindOrInsertBatch.
+    template <class T> void FindOrInsertBatch(const T *entries, std::size_t count, MutableIterator *out, bool *found) {
+      for (std::size_t i = 0; i < count; ++i) Prefetch(entries[i].GetKey());
+      for (std::size_t i = 0; i < count; ++i) found[i] = FindOrInsert(entries[i], out[i]);
+    }
+
+    // Don't change anything related to GetKey.
+    template <class K> bool UnsafeMutableFind(const K key, MutableIterator &out) {
+      std::size_t slot;
+      uint8_t tag;
+      if (!Lookup(key, slot, tag)) return false;
+      out = begin_ + slot;
+      return true;
+    }
+
+    // Like UnsafeMutableFind, but the key must be there.
+    template <class K> MutableIterator UnsafeMutableMustFind(const K key) {
+      MutableIterator ret;
+      bool found = UnsafeMutableFind(key, ret);
+      assert(found);
+      (void)found;
+      return ret;
+    }
+
+    template <class K> bool Find(const K key, ConstIterator &out) const {
+      std::size_t slot;
+      uint8_t tag;
+      if (!Lookup(key, slot, tag)) return false;
+      out = begin_ + slot;
+      return true;
+    }
+
+    // Like Find but we're sure it must be there.
+    template <class K> ConstIterator MustFind(const K key) const {
+      ConstIterator ret;
+      bool found = Find(key, ret);
+      assert(found);
+      (void)found;
+      return ret;
+    }
+
+    void Clear() {
+      memset(ctrl_, kEmpty, slots_);
+      entries_ = 0;
+    }
+
+    std::size_t SizeNoSerialization() const {
+      return entries_;
+    }
+
+    std::size_t Slots() const { return slots_; }
+
+    // Insert every entry into to, which must be big enough.
+    void CopyTo(GroupProbingHashTable &to) const {
+      for (std::size_t i = 0; i < slots_; ++i) {
+        if (ctrl_[i] != kEmpty) {
+          to.UncheckedInsert(begin_[i]);
+          ++to.entries_;
+        }
+      }
+    }
+
+  private:
+    static const uint8_t kEmpty = 0x80;
+
+    static uint8_t Tag(uint64_t hash) {
+      return static_cast<uint8_t>(hash >> 57);
+    }
+
+    // Bit i is set if control byte i of the group equals tag.
+    static unsigned Match(const uint8_t *group, uint8_t tag) {
+#ifdef HAVE_SSE2
+      __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+      return _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(static_cast<char>(tag))));
+#else
+      unsigned ret = 0;
+      for (unsigned i = 0; i < kGroup; ++i) ret |= (group[i] == tag) << i;
+      return ret;
+#endif
+    }
+
+    // Bit i is set if slot i of the group is empty.  Tags are below 0x80.
+    static unsigned MatchEmpty(const uint8_t *group) {
+#ifdef HAVE_SSE2
+      return _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(group)));
+#else
+      return Match(group, kEmpty);
+#endif
+    }
+
+    // If found, slot is where the key is.  Otherwise slot is where it goes.
+    template <class K> bool Lookup(const K key, std::size_t &slot, uint8_t &tag) const {
+      uint64_t hash = hash_(key);
+      tag = Tag(hash);
+      for (std::size_t group = hash & groups_mask_;; group = (group + 1) & groups_mask_) {
+        const std::size_t base = group * kGroup;
+        for (unsigned match = Match(ctrl_ + base, tag); match; match &= match - 1) {
+          std::size_t i = base + detail::LowestBit(match);
+          if (equal_(begin_[i].GetKey(), key)) {
+            slot = i;
+            return true;
+          }
+        }
+        // No deletion, so an empty slot ends the search.
+        if (unsigned empty = MatchEmpty(ctrl_ + base)) {
+          slot = base + detail::LowestBit(empty);
+          return false;
+        }
+      }
+    }
+
+    template <class T> MutableIterator UncheckedInsert(const T &t) {
+      uint64_t hash = hash_(t.GetKey());
+      for (std::size_t group = hash & groups_mask_;; group = (group + 1) & groups_mask_) {
+        if (unsigned empty = MatchEmpty(ctrl_ + group * kGroup)) {
+          std::size_t i = group * kGroup + detail::LowestBit(empty);
+          ctrl_[i] = Tag(hash);
+          begin_[i] = t;
+          return begin_ + i;
+        }
+      }
+    }
+
+    MutableIterator begin_;
+    uint8_t *ctrl_;
+    std::size_t slots_;
+    std::size_t groups_mask_;
+    Hash hash_;
+    Equal equal_;
+    std::size_t entries_;
+};
+
+// Resizable GroupProbingHashTable that owns its memory, like AutoProbing.
+template <class EntryT, class HashT, class EqualT = std::equal_to<typename EntryT::Key> > class AutoGroupProbing {
+  private:
+    typedef GroupProbingHashTable<EntryT, HashT, EqualT> Backend;
+  public:
+    typedef EntryT Entry;
+    typedef typename Entry::Key Key;
+    typedef const Entry *ConstIterator;
+    typedef Entry *MutableIterator;
+    typedef HashT Hash;
+    typedef EqualT Equal;
+
+    AutoGroupProbing(std::size_t initial_size = 10, const Key &invalid = Key(), const Hash &hash_func = Hash(), const Equal &equal_func = Equal()) :
+      invalid_(invalid), hash_(hash_func), equal_(equal_func),
+      allocated_(Backend::Size(initial_size, 1.25)), mem_(allocated_, false), backend_(mem_.get(), allocated_, invalid, hash_func, equal_func), interleave_(false) {
+      SetThreshold();
+      Clear();
+    }
+
+    // Assumes that the key is unique.  Multiple insertions won't cause a failure, just inconsistent lookup.
+    template <class T> MutableIterator Insert(const T &t) {
+      DoubleIfNeeded();
+      return backend_.Insert(t);
+    }
+
+    template <class T> bool FindOrInsert(const T &t, MutableIterator &out) {
+      DoubleIfNeeded();
+      return backend_.FindOrInsert(t, out);
+    }
+
+    template <class K> bool UnsafeMutableFind(const K key, MutableIterator &out) {
+      return backend_.UnsafeMutableFind(key, out);
+    }
+
+    template <class K> MutableIterator UnsafeMutableMustFind(const K key) {
+      return backend_.UnsafeMutableMustFind(key);
+    }
+
+    template <class K> bool Find(const K key, ConstIterator &out) const {
+      return backend_.Find(key, out);
+    }
+
+    template <class K> ConstIterator MustFind(const K key) const {
+      return backend_.MustFind(key);
+    }
+
+    template <class K> void Prefetch(const K key) const {
+      backend_.Prefetch(key);
+    }
+
+    template <class K> void FindBatch(const K *keys, std::size_t count, ConstIterator *out, bool *found) const {
+      backend_.FindBatch(keys, count, out, found);
+    }
+
+    // Grows first if needed so every out stays valid.
+    template <class T> void FindOrInsertBatch(const T *entries, std::size_t count, MutableIterator *out, bool *found) {
+      Reserve(Size() + count);
+      backend_.FindOrInsertBatch(entries, count, out, found);
+    }
+
+    std::size_t Size() const {
+      return backend_.SizeNoSerialization();
+    }
+
+    void Clear() {
+      backend_.Clear();
+    }
+
+    // Bytes allocated for entries and control bytes.
+    std::size_t MemoryUsage() const {
+      return allocated_;
+    }
+
+    // Grow now so that entries fit without growing later.
+    void Reserve(std::size_t entries) {
+      if (threshold_ >= entries) return;
+      std::size_t slots = backend_.Slots();
+      while (slots - slots / 8 < entries) slots *= 2;
+      Resize(slots);
+    }
+
+    // Like AutoProbing::InterleaveNUMA.
+    void InterleaveNUMA() {
+      interleave_ = true;
+      util::InterleaveNUMA(mem_);
+    }
+
+  private:
+    void SetThreshold() {
+      // Maximum load 7/8.
+      threshold_ = backend_.Slots() - backend_.Slots() / 8;
+    }
+
+    void DoubleIfNeeded() {
+      if (Size() < threshold_)
+        return;
+      Resize(backend_.Slots() * 2);
+    }
+
+    void Resize(std::size_t slots) {
+      std::size_t allocated = Backend::SizeForSlots(slots);
+      // The old table is copied out, so this can't be HugeRealloc.
+      util::scoped_memory mem(allocated, false);
+      if (interleave_) util::InterleaveNUMA(mem);
+      Backend backend(mem.get(), allocated, invalid_, hash_, equal_);
+      backend.Clear();
+      backend_.CopyTo(backend);
+      mem_.reset(mem.get(), mem.size(), mem.source());
+      mem.steal();
+      allocated_ = allocated;
+      backend_ = backend;
+      SetThreshold();
+    }
+
+    const Key invalid_;
+    const Hash hash_;
+    const Equal equal_;
+
+    std::size_t allocated_;
+    util::scoped_memory mem_;
+    Backend backend_;
+    std::size_t threshold_;
+    bool interleave_;
+};
+
+} // namespace util
+
+#endif // UTIL_GROUP_PROBING_HASH_TABLE_H
@@ -0,0 +1,116 @@
+#include "util/group_probing_hash_table.hh"
+
+#include "util/murmur_hash.hh"
+#include "util/scoped.hh"
+
+#define BOOST_TEST_MODULE GroupProbingHashTableTest
+#include <boost/test/unit_test.hpp>
+
+#include <stdint.h>
+
+namespace util {
+namespace {
+
+struct Entry {
+  typedef uint64_t Key;
+  uint64_t key;
+  uint64_t value;
+  Key GetKey() const { return key; }
+  void SetKey(uint64_t to) { key = to; }
+};
+
+struct MurmurHashEntry {
+  uint64_t operator()(uint64_t value) const {
+    return util::MurmurHash64A(&value, 8);
+  }
+};
+
+// Every key lands in the same group, so this probes across groups.
+struct ConstantHash {
+  uint64_t operator()(uint64_t value) const {
+    return 0x1234 | (value << 57);
+  }
+};
+
+typedef GroupProbingHashTable<Entry, MurmurHashEntry> Table;
+
+BOOST_AUTO_TEST_CASE(Simple) {
+  std::size_t size = Table::Size(10, 1.2);
+  scoped_malloc mem(MallocOrThrow(size));
+  Table table(mem.get(), size);
+  table.Clear();
+  Table::ConstIterator i = NULL;
+  BOOST_CHECK(!table.Find(2, i));
+  Entry entry;
+  entry.key = 3;
+  entry.value = 328920;
+  table.Insert(entry);
+  BOOST_REQUIRE(table.Find(3, i));
+  BOOST_CHECK_EQUAL(3, i->GetKey());
+  BOOST_CHECK_EQUAL(328920, i->value);
+  BOOST_CHECK(!table.Find(2, i));
+  // Zero is an ordinary key.
+  entry.key = 0;
+  Table::MutableIterator it;
+  BOOST_CHECK(!table.FindOrInsert(entry, it));
+  BOOST_CHECK(table.FindOrInsert(entry, it));
+  BOOST_CHECK_EQUAL(2, table.SizeNoSerialization());
+}
+
+BOOST_AUTO_TEST_CASE(Full) {
+  std::size_t size = Table::SizeForSlots(16);
+  scoped_malloc mem(MallocOrThrow(size));
+  Table table(mem.get(), size);
+  table.Clear();
+  Entry entry;
+  for (entry.key = 0; entry.key < 15; ++entry.key) {
+    table.Insert(entry);
+  }
+  BOOST_CHECK_THROW(table.Insert(entry), ProbingSizeException);
+}
+
+BOOST_AUTO_TEST_CASE(Collide) {
+  AutoGroupProbing<Entry, ConstantHash> table;
+  AutoGroupProbing<Entry, ConstantHash>::MutableIterator it;
+  Entry entry;
+  for (uint64_t i = 0; i < 100; ++i) {
+    entry.key = i;
+    entry.value = i * 3;
+    BOOST_REQUIRE(!table.FindOrInsert(entry, it));
+  }
+  AutoGroupProbing<Entry, ConstantHash>::ConstIterator found = NULL;
+  for (uint64_t i = 0; i < 100; ++i) {
+    BOOST_REQUIRE(table.Find(i, found));
+    BOOST_CHECK_EQUAL(i * 3, found->value);
+  }
+  BOOST_CHECK(!table.Find(100, found));
+}
+
+BOOST_AUTO_TEST_CASE(Grow) {
+  AutoGroupProbing<Entry, MurmurHashEntry> table;
+  AutoGroupProbing<Entry, MurmurHashEntry>::MutableIterator it;
+  Entry entry;
+  for (uint64_t i = 0; i < 100000; ++i) {
+    entry.key = i;
+    entry.value = i + 1;
+    BOOST_REQUIRE(!table.FindOrInsert(entry, it));
+    entry.key = i / 2;
+    BOOST_REQUIRE(table.FindOrInsert(entry, it));
+    BOOST_REQUIRE_EQUAL(i / 2 + 1, it->value);
+  }
+  BOOST_CHECK_EQUAL(100000, table.Size());
+  std::size_t memory = table.MemoryUsage();
+  table.Reserve(100000);
+  BOOST_CHECK_EQUAL(memory, table.MemoryUsage());
+  table.Reserve(1000000);
+  BOOST_CHECK_LT(memory, table.MemoryUsage());
+  AutoGroupProbing<Entry, MurmurHashEntry>::ConstIterator found = NULL;
+  for (uint64_t i = 0; i < 100000; ++i) {
+    BOOST_REQUIRE(table.Find(i, found));
+    BOOST_REQUIRE_EQUAL(i + 1, found->value);
+  }
+  BOOST_CHECK(!table.Find(100000, found));
+}
+
+} // namespace
+} // namespace util
@@ -10,4 +10,9 @@
 //#define HAVE_BOOST
 #endif
 
+// SSE2 intrinsics from <emmintrin.h>, which every x86-64 compiler has.
+#if !defined(HAVE_SSE2) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define HAVE_SSE2
+#endif
+
 #endif // UTIL_HAVE__
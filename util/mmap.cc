@@ -24,6 +24,13 @@
 #include <unistd.h>
 #endif
 
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <cstdio>
+#include <vector>
+#endif
+
 namespace util {
 
 std::size_t SizePage() {
@@ -263,7 +270,7 @@ void HugeRealloc(std::size_t to, bool zero_new, scoped_memory &mem) {
         mem.reset(replacement.release(), to, scoped_memory::MALLOC_ALLOCATED);
       } else {
         void *new_addr = mremap(mem.get(), from_size, to, MREMAP_MAYMOVE);
-        UTIL_THROW_IF(!new_addr, ErrnoException, "Failed to mremap from " << from_size << " to " << to);
+        UTIL_THROW_IF(new_addr == MAP_FAILED, ErrnoException, "Failed to mremap from " << from_size << " to " << to);
         mem.steal();
         mem.reset(new_addr, to, scoped_memory::MMAP_ALLOCATED);
       }
@@ -296,6 +303,45 @@ void HugeRealloc(std::size_t to, bool zero_new, scoped_memory &mem) {
   }
 }
 
+#if defined(__linux__) && defined(SYS_mbind)
+namespace {
+// Bit mask of the online NUMA nodes, from a list like 0-3,6 in sysfs.
+bool OnlineNodes(std::vector<unsigned long> &mask) {
+  std::FILE *file = std::fopen("/sys/devices/system/node/online", "r");
+  if (!file) return false;
+  char line[4096];
+  bool read = std::fgets(line, sizeof(line), file);
+  std::fclose(file);
+  if (!read) return false;
+  const std::size_t kBits = sizeof(unsigned long) * 8;
+  for (char *i = line; *i >= '0' && *i <= '9';) {
+    unsigned long first = std::strtoul(i, &i, 10), last = first;
+    if (*i == '-') last = std::strtoul(i + 1, &i, 10);
+    for (unsigned long node = first; node <= last; ++node) {
+      if (mask.size() <= node / kBits) mask.resize(node / kBits + 1);
+      mask[node / kBits] |= 1UL << (node % kBits);
+    }
+    if (*i == ',') ++i;
+  }
+  return !mask.empty();
+}
+} // namespace
+#endif
+
+bool InterleaveNUMA(const scoped_memory &mem) {
+#if defined(__linux__) && defined(SYS_mbind)
+  // Pages of malloc memory may be shared with other allocations.
+  if (mem.source() != scoped_memory::MMAP_ALLOCATED && mem.source() != scoped_memory::MMAP_ROUND_UP_ALLOCATED) return false;
+  std::vector<unsigned long> mask;
+  if (!OnlineNodes(mask)) return false;
+  // The kernel reads one less than maxnode bits.
+  unsigned long maxnode = mask.size() * sizeof(unsigned long) * 8 + 1;
+  return !syscall(SYS_mbind, mem.get(), RoundUpPow2(mem.size(), SizePage()), MPOL_INTERLEAVE, &mask[0], maxnode, 0);
+#else
+  return false;
+#endif
+}
+
 void MapRead(LoadMethod method, int fd, uint64_t offset, std::size_t size, scoped_memory &out) {
   switch (method) {
     case LAZY:
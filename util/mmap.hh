@@ -139,6 +139,12 @@ void HugeMalloc(std::size_t size, bool zeroed, scoped_memory &to);
 // this.
 void HugeRealloc(std::size_t size, bool new_zeroed, scoped_memory &mem);
 
+// Spread the pages of mem round-robin across NUMA nodes so that threads on
+// every node see the same average latency.  Only pages touched afterwards are
+// placed this way, so call it before filling the memory.  Returns false if
+// that wasn't possible: the memory came from malloc, or not Linux.
+bool InterleaveNUMA(const scoped_memory &mem);
+
 enum LoadMethod {
   // mmap with no prepopulate
   LAZY,
@@ -1,26 +1,60 @@
 #include "util/mutable_vocab.hh"
 
-#include "util/murmur_hash.hh"
+#include "util/exception.hh"
+#include "util/fake_ofstream.hh"
+#include "util/file.hh"
+#include "util/scoped.hh"
+
+#include <cstring>
 
 namespace util {
 
-MutableVocab::MutableVocab() {
+namespace {
+
+/* File format, native byte order:
+ *   VocabHeader
+ *   ProbingHashTable of MutableVocabInternal, table_bytes long, padded to 8
+ *   uint64_t offsets[strings + 1] into the string blob, by ID
+ *   string blob, blob_bytes long
+ */
+const char kVocabMagic[8] = {'m', 'v', 'o', 'c', 'a', 'b', '1', '\0'};
+
+struct VocabHeader {
+  char magic[8];
+  // Hash of <unk>, to catch mapping with a different hash function.
+  uint64_t check;
+  uint64_t table_bytes;
+  uint64_t strings;
+  uint64_t blob_bytes;
+};
+
+std::size_t PadTo8(std::size_t size) {
+  return (size + 7) & ~static_cast<std::size_t>(7);
+}
+
+typedef ProbingHashTable<MutableVocabInternal, IdentityHash> FileTable;
+
+} // namespace
+
+template <template <class, class, class> class TableT, class HashT> const typename GenericMutableVocab<TableT, HashT>::ID GenericMutableVocab<TableT, HashT>::kUNK;
+
+template <template <class, class, class> class TableT, class HashT> GenericMutableVocab<TableT, HashT>::GenericMutableVocab() {
   strings_.push_back(StringPiece("<unk>"));
 }
 
-MutableVocab::ID MutableVocab::Find(const StringPiece &str) const {
-  Map::ConstIterator it;
-  if (map_.Find(util::MurmurHashNative(str.data(), str.size()), it)) {
+template <template <class, class, class> class TableT, class HashT> typename GenericMutableVocab<TableT, HashT>::ID GenericMutableVocab<TableT, HashT>::Find(const StringPiece &str) const {
+  typename Map::ConstIterator it;
+  if (map_.Find(MutableVocabKey<HashT>(str), it)) {
     return it->id;
   } else {
     return kUNK;
   }
 }
 
-uint32_t MutableVocab::FindOrInsert(const StringPiece &str) {
+template <template <class, class, class> class TableT, class HashT> uint32_t GenericMutableVocab<TableT, HashT>::FindOrInsert(const StringPiece &str) {
   MutableVocabInternal entry;
-  entry.key = util::MurmurHashNative(str.data(), str.size());
-  Map::MutableIterator it;
+  entry.key = MutableVocabKey<HashT>(str);
+  typename Map::MutableIterator it;
   if (map_.FindOrInsert(entry, it)) {
     return it->id;
   }
@@ -32,4 +66,72 @@ uint32_t MutableVocab::FindOrInsert(const StringPiece &str) {
   return it->id;
 }
 
+template <template <class, class, class> class TableT, class HashT> void GenericMutableVocab<TableT, HashT>::Save(const char *file) const {
+  // Rebuild the table since TableT may be laid out differently.
+  std::size_t table_bytes = FileTable::Size(strings_.size(), 1.5);
+  scoped_malloc table_mem(MallocOrThrow(table_bytes));
+  FileTable table(table_mem.get(), table_bytes);
+  table.Clear();
+  std::vector<uint64_t> offsets;
+  offsets.reserve(strings_.size() + 1);
+  offsets.push_back(0);
+  offsets.push_back(strings_[0].size());
+  MutableVocabInternal entry;
+  for (std::size_t i = 1; i < strings_.size(); ++i) {
+    entry.key = MutableVocabKey<HashT>(strings_[i]);
+    entry.id = i;
+    table.Insert(entry);
+    offsets.push_back(offsets.back() + strings_[i].size());
+  }
+
+  VocabHeader header;
+  std::memcpy(header.magic, kVocabMagic, sizeof(kVocabMagic));
+  header.check = HashT()("<unk>", 5);
+  header.table_bytes = table_bytes;
+  header.strings = strings_.size();
+  header.blob_bytes = offsets.back();
+
+  scoped_fd fd(CreateOrThrow(file));
+  FakeOFStream out(fd.get());
+  out << StringPiece(reinterpret_cast<const char*>(&header), sizeof(VocabHeader));
+  out << StringPiece(static_cast<const char*>(table_mem.get()), table_bytes);
+  const char kZeros[8] = {0};
+  out << StringPiece(kZeros, PadTo8(table_bytes) - table_bytes);
+  out << StringPiece(reinterpret_cast<const char*>(&offsets[0]), offsets.size() * sizeof(uint64_t));
+  for (std::vector<StringPiece>::const_iterator i = strings_.begin(); i != strings_.end(); ++i) {
+    out << *i;
+  }
+  out.Flush();
+}
+
+template class GenericMutableVocab<AutoProbing, MurmurHasher>;
+template class GenericMutableVocab<AutoGroupProbing, MurmurHasher>;
+template class GenericMutableVocab<AutoProbing, FastHasher>;
+template class GenericMutableVocab<AutoGroupProbing, FastHasher>;
+
+template <class HashT> const typename GenericMappedVocab<HashT>::ID GenericMappedVocab<HashT>::kUNK;
+
+template <class HashT> GenericMappedVocab<HashT>::GenericMappedVocab(const char *file, LoadMethod method) {
+  scoped_fd fd(OpenReadOrThrow(file));
+  uint64_t file_size = SizeOrThrow(fd.get());
+  UTIL_THROW_IF2(file_size < sizeof(VocabHeader), file << " is too small to be a vocabulary");
+  MapRead(method, fd.get(), 0, file_size, mem_);
+  const VocabHeader &header = *static_cast<const VocabHeader*>(mem_.get());
+  UTIL_THROW_IF2(std::memcmp(header.magic, kVocabMagic, sizeof(kVocabMagic)), file << " is not a vocabulary file from MutableVocab::Save");
+  UTIL_THROW_IF2(header.check != HashT()("<unk>", 5), file << " was saved with a different hash function");
+  uint64_t table_begin = sizeof(VocabHeader);
+  uint64_t offsets_begin = table_begin + PadTo8(header.table_bytes);
+  uint64_t strings_begin = offsets_begin + (header.strings + 1) * sizeof(uint64_t);
+  UTIL_THROW_IF2(!header.strings || strings_begin + header.blob_bytes != file_size, file << " has the wrong size for its header");
+  char *base = static_cast<char*>(mem_.get());
+  // The table is only read.
+  table_ = Table(base + table_begin, header.table_bytes);
+  offsets_ = reinterpret_cast<const uint64_t*>(base + offsets_begin);
+  strings_ = base + strings_begin;
+  size_ = header.strings;
+}
+
+template class GenericMappedVocab<MurmurHasher>;
+template class GenericMappedVocab<FastHasher>;
+
 } // namespace util
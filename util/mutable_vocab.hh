@@ -5,10 +5,16 @@
  * a specialized immutable vocabulary.
  */
 
+#include "util/fast_hash.hh"
+#include "util/group_probing_hash_table.hh"
+#include "util/mmap.hh"
 #include "util/pool.hh"
 #include "util/probing_hash_table.hh"
 #include "util/string_piece.hh"
 
+#include <functional>
+#include <vector>
+
 #include <stdint.h>
 
 namespace util {
@@ -24,14 +30,24 @@ struct MutableVocabInternal {
   uint32_t id;
 };
 #pragma pack(pop)
- 
-class MutableVocab {
+
+// Key 0 marks empty buckets, so a string that hashes to 0 (like the empty
+// string with MurmurHasher) gets key 1 instead.
+template <class HashT> inline uint64_t MutableVocabKey(const StringPiece &str) {
+  uint64_t ret = HashT()(str.data(), str.size());
+  return ret ? ret : 1;
+}
+
+/* TableT is AutoProbing or AutoGroupProbing and HashT is MurmurHasher or
+ * FastHasher.  All four are instantiated in mutable_vocab.cc.
+ */
+template <template <class, class, class> class TableT, class HashT = MurmurHasher> class GenericMutableVocab {
   public:
     typedef uint32_t ID;
 
     static const ID kUNK = 0;
 
-    MutableVocab();
+    GenericMutableVocab();
     
     uint32_t Find(const StringPiece &str) const;
 
@@ -43,15 +59,72 @@ class MutableVocab {
 
     // Includes kUNK.
     std::size_t Size() const { return strings_.size(); }
+
+    // Write a file for GenericMappedVocab<HashT>.
+    void Save(const char *file) const;
+
+    // Bytes held by the hash table, the strings, and the ID to string array.
+    std::size_t MemoryUsage() const {
+      return map_.MemoryUsage() + piece_backing_.Reserved() + strings_.capacity() * sizeof(StringPiece);
+    }
+
+    const Pool &StringPool() const { return piece_backing_; }
     
   private:
     util::Pool piece_backing_;
 
-    typedef util::AutoProbing<MutableVocabInternal, util::IdentityHash> Map;
+    typedef TableT<MutableVocabInternal, util::IdentityHash, std::equal_to<uint64_t> > Map;
     Map map_;
 
     std::vector<StringPiece> strings_;
 };
 
+typedef GenericMutableVocab<AutoProbing> MutableVocab;
+typedef GenericMutableVocab<AutoGroupProbing> GroupMutableVocab;
+typedef GenericMutableVocab<AutoProbing, FastHasher> FastMutableVocab;
+
+/* Read-only vocabulary from a file written by GenericMutableVocab::Save with
+ * the same HashT.  The file holds a probing hash table, string offsets by ID,
+ * and the strings, so it is mapped rather than parsed and loading does not
+ * depend on its size.  IDs are the same as in the saved vocabulary.  The file
+ * is in native byte order.
+ */
+template <class HashT = MurmurHasher> class GenericMappedVocab {
+  public:
+    typedef uint32_t ID;
+
+    static const ID kUNK = 0;
+
+    explicit GenericMappedVocab(const char *file, LoadMethod method = LAZY);
+
+    ID Find(const StringPiece &str) const {
+      Table::ConstIterator it;
+      return table_.Find(MutableVocabKey<HashT>(str), it) ? it->id : kUNK;
+    }
+
+    StringPiece String(ID id) const {
+      return StringPiece(strings_ + offsets_[id], offsets_[id + 1] - offsets_[id]);
+    }
+
+    // Includes kUNK.
+    std::size_t Size() const { return size_; }
+
+  private:
+    typedef ProbingHashTable<MutableVocabInternal, IdentityHash> Table;
+
+    scoped_memory mem_;
+
+    Table table_;
+
+    const uint64_t *offsets_;
+
+    const char *strings_;
+
+    std::size_t size_;
+};
+
+typedef GenericMappedVocab<MurmurHasher> MappedVocab;
+typedef GenericMappedVocab<FastHasher> FastMappedVocab;
+
 } // namespace util
 #endif // UTIL_MUTABLE_VOCAB__
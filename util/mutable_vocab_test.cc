@@ -1,17 +1,92 @@
 #include "util/mutable_vocab.hh"
 
+#include "util/file.hh"
+
+#define BOOST_LEXICAL_CAST_ASSUME_C_LOCALE
+#include <boost/lexical_cast.hpp>
+
 #define BOOST_TEST_MODULE MutableVocabTest
 #include <boost/test/unit_test.hpp>
 
+#include <cstdio>
+#include <string>
+
+#include <unistd.h>
+
 namespace util {
 namespace {
 
-BOOST_AUTO_TEST_CASE(small) {
-  MutableVocab vocab;
+template <class Vocab> void Small() {
+  Vocab vocab;
   BOOST_CHECK_EQUAL(1, vocab.FindOrInsert("Foo"));
   BOOST_CHECK_EQUAL(2, vocab.Size());
   BOOST_CHECK_EQUAL(1, vocab.Find("Foo"));
   BOOST_CHECK_EQUAL("Foo", vocab.String(1));
+  BOOST_CHECK_EQUAL(Vocab::kUNK, vocab.Find("Bar"));
+}
+
+BOOST_AUTO_TEST_CASE(small) {
+  Small<MutableVocab>();
+}
+
+BOOST_AUTO_TEST_CASE(group) {
+  Small<GroupMutableVocab>();
+}
+
+// MurmurHash of the empty string is 0, which marks empty buckets.
+BOOST_AUTO_TEST_CASE(empty_string) {
+  MutableVocab vocab;
+  BOOST_CHECK_EQUAL(1, vocab.FindOrInsert(""));
+  BOOST_CHECK_EQUAL(1, vocab.FindOrInsert(""));
+  BOOST_CHECK_EQUAL(2, vocab.FindOrInsert("Foo"));
+  BOOST_CHECK_EQUAL(1, vocab.Find(""));
+}
+
+BOOST_AUTO_TEST_CASE(fast) {
+  Small<FastMutableVocab>();
+  Small<GenericMutableVocab<AutoGroupProbing, FastHasher> >();
+}
+
+// Removes the file when done.
+class TempName {
+  public:
+    TempName() : name_(DefaultTempDirectory() + "mutable_vocab_test" + boost::lexical_cast<std::string>(getpid())) {}
+    ~TempName() { std::remove(name_.c_str()); }
+    const char *get() const { return name_.c_str(); }
+  private:
+    std::string name_;
+};
+
+template <class Vocab, class Mapped> void SaveAndMap() {
+  Vocab vocab;
+  for (unsigned i = 0; i < 10000; ++i) {
+    vocab.FindOrInsert(boost::lexical_cast<std::string>(i * 7));
+  }
+  vocab.FindOrInsert("");
+  TempName file;
+  vocab.Save(file.get());
+  Mapped mapped(file.get());
+  BOOST_REQUIRE_EQUAL(vocab.Size(), mapped.Size());
+  for (typename Vocab::ID i = 0; i < vocab.Size(); ++i) {
+    BOOST_REQUIRE_EQUAL(vocab.String(i), mapped.String(i));
+    if (i) BOOST_REQUIRE_EQUAL(i, mapped.Find(vocab.String(i)));
+  }
+  BOOST_CHECK_EQUAL(Mapped::kUNK, mapped.Find("1"));
+  BOOST_CHECK_EQUAL(Mapped::kUNK, mapped.Find("<unk>"));
+}
+
+BOOST_AUTO_TEST_CASE(mapped) {
+  SaveAndMap<MutableVocab, MappedVocab>();
+  SaveAndMap<GroupMutableVocab, MappedVocab>();
+  SaveAndMap<FastMutableVocab, FastMappedVocab>();
+}
+
+BOOST_AUTO_TEST_CASE(mapped_wrong_hash) {
+  MutableVocab vocab;
+  vocab.FindOrInsert("Foo");
+  TempName file;
+  vocab.Save(file.get());
+  BOOST_CHECK_THROW(FastMappedVocab mapped(file.get()), util::Exception);
 }
 
 } // namespace
@@ -1,38 +1,80 @@
 #include "util/pool.hh"
 
-#include "util/scoped.hh"
-
-#include <cstdlib>
-
 #include <algorithm>
 
 namespace util {
 
-Pool::Pool() {
-  current_ = NULL;
-  current_end_ = NULL;
-}
+Pool::Pool(std::size_t first_block, std::size_t max_block)
+  : current_(NULL), current_end_(NULL), first_block_(first_block), next_block_(first_block), max_block_(max_block), reserved_(0), wasted_(0) {}
 
 Pool::~Pool() {
   FreeAll();
 }
 
 void Pool::FreeAll() {
-  for (std::vector<void *>::const_iterator i(free_list_.begin()); i != free_list_.end(); ++i) {
-    free(*i);
+  for (std::vector<Block>::const_iterator i(free_list_.begin()); i != free_list_.end(); ++i) {
+    scoped_memory freed(i->base, i->size, i->source);
   }
   free_list_.clear();
   current_ = NULL;
   current_end_ = NULL;
+  next_block_ = first_block_;
+  reserved_ = 0;
+  wasted_ = 0;
 }
 
 void *Pool::More(std::size_t size) {
-  std::size_t amount = std::max(static_cast<size_t>(32) << free_list_.size(), size);
-  uint8_t *ret = static_cast<uint8_t*>(MallocOrThrow(amount));
-  free_list_.push_back(ret);
+  // The caller already advanced current_ by size past the old position.
+  if (!free_list_.empty()) wasted_ += current_end_ - (current_ - size);
+  std::size_t amount = std::max(next_block_, size);
+  next_block_ = next_block_ > max_block_ / 2 ? max_block_ : next_block_ * 2;
+  scoped_memory mem;
+  HugeMalloc(amount, false, mem);
+  Block block;
+  block.base = mem.get();
+  block.size = mem.size();
+  block.source = mem.source();
+  free_list_.push_back(block);
+  mem.steal();
+  reserved_ += amount;
+  uint8_t *ret = static_cast<uint8_t*>(block.base);
   current_ = ret + size;
   current_end_ = ret + amount;
   return ret;
 }
 
+ThreadLocalPool::~ThreadLocalPool() {
+  for (Map::iterator i = pools_.begin(); i != pools_.end(); ++i) {
+    delete i->second;
+  }
+}
+
+Pool &ThreadLocalPool::Local() {
+  boost::unique_lock<boost::mutex> lock(mutex_);
+  Pool *&ret = pools_[boost::this_thread::get_id()];
+  if (!ret) ret = new Pool(first_block_, max_block_);
+  return *ret;
+}
+
+std::size_t ThreadLocalPool::Requested() const {
+  boost::unique_lock<boost::mutex> lock(mutex_);
+  std::size_t ret = 0;
+  for (Map::const_iterator i = pools_.begin(); i != pools_.end(); ++i) ret += i->second->Requested();
+  return ret;
+}
+
+std::size_t ThreadLocalPool::Reserved() const {
+  boost::unique_lock<boost::mutex> lock(mutex_);
+  std::size_t ret = 0;
+  for (Map::const_iterator i = pools_.begin(); i != pools_.end(); ++i) ret += i->second->Reserved();
+  return ret;
+}
+
+std::size_t ThreadLocalPool::Wasted() const {
+  boost::unique_lock<boost::mutex> lock(mutex_);
+  std::size_t ret = 0;
+  for (Map::const_iterator i = pools_.begin(); i != pools_.end(); ++i) ret += i->second->Wasted();
+  return ret;
+}
+
 } // namespace util
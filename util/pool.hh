@@ -1,8 +1,15 @@
 #ifndef UTIL_POOL_H
 #define UTIL_POOL_H
 
+#include "util/mmap.hh"
+
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+
 #include <cassert>
 #include <cstring>
+#include <limits>
+#include <map>
 #include <vector>
 
 #include <stdint.h>
@@ -10,11 +17,15 @@
 namespace util {
 
 /* Very simple pool.  It can only allocate memory.  And all of the memory it
- * allocates must be freed at the same time.
+ * allocates must be freed at the same time.  Blocks start at first_block bytes
+ * and double up to max_block; an allocation bigger than the next block gets a
+ * block of its own size.  Blocks come from HugeMalloc, so those of 2 MB or
+ * more are backed by huge pages.  Pool(1 << 21, 1 << 21) uses huge pages from
+ * the start and wastes at most 2 MB per block.
  */
 class Pool {
   public:
-    Pool();
+    explicit Pool(std::size_t first_block = 32, std::size_t max_block = std::numeric_limits<std::size_t>::max());
 
     ~Pool();
 
@@ -62,13 +73,38 @@ class Pool {
 
     void FreeAll();
 
+    // Bytes handed out by Allocate and Continue, not counting memory left
+    // behind when Continue moved to a new block.
+    std::size_t Requested() const {
+      return reserved_ - wasted_ - (current_end_ - current_);
+    }
+
+    // Bytes in blocks.
+    std::size_t Reserved() const { return reserved_; }
+
+    // Bytes left unused at the ends of full blocks, plus anything Continue
+    // copied out of them.
+    std::size_t Wasted() const { return wasted_; }
+
   private:
     void *More(std::size_t size);
 
-    std::vector<void *> free_list_;
+    struct Block {
+      void *base;
+      std::size_t size;
+      scoped_memory::Alloc source;
+    };
+
+    std::vector<Block> free_list_;
 
     uint8_t *current_, *current_end_;
 
+    const std::size_t first_block_;
+    std::size_t next_block_;
+    const std::size_t max_block_;
+
+    std::size_t reserved_, wasted_;
+
 #ifdef DEBUG
     // For debugging, check that Continue came from the most recent call.
     void *base_check_;
@@ -79,6 +115,39 @@ class Pool {
     Pool &operator=(const Pool &);
 };
 
+/* A Pool for each thread, for multi-threaded tools.  Local returns the
+ * calling thread's pool, creating it on the first call from that thread.
+ * Local takes a lock, so call it once per thread and keep the reference.
+ * All memory is freed when this is destroyed, not when threads exit; a new
+ * thread may be given the pool of one that exited.
+ */
+class ThreadLocalPool {
+  public:
+    explicit ThreadLocalPool(std::size_t first_block = 32, std::size_t max_block = std::numeric_limits<std::size_t>::max())
+      : first_block_(first_block), max_block_(max_block) {}
+
+    ~ThreadLocalPool();
+
+    Pool &Local();
+
+    // Totals over all threads' pools.  Only call while no thread allocates.
+    std::size_t Requested() const;
+    std::size_t Reserved() const;
+    std::size_t Wasted() const;
+
+  private:
+    const std::size_t first_block_, max_block_;
+
+    mutable boost::mutex mutex_;
+
+    typedef std::map<boost::thread::id, Pool*> Map;
+    Map pools_;
+
+    // no copying
+    ThreadLocalPool(const ThreadLocalPool &);
+    ThreadLocalPool &operator=(const ThreadLocalPool &);
+};
+
 /**
  * Pool designed to allow limited freeing.
  * Keeps a linked list of free elements in the free spaces.
@@ -0,0 +1,89 @@
+#include "util/pool.hh"
+
+#include <boost/bind.hpp>
+#include <boost/thread/thread.hpp>
+
+#define BOOST_TEST_MODULE PoolTest
+#include <boost/test/unit_test.hpp>
+
+namespace util {
+namespace {
+
+BOOST_AUTO_TEST_CASE(doubling) {
+  Pool pool;
+  BOOST_CHECK_EQUAL(0, pool.Reserved());
+  pool.Allocate(20);
+  BOOST_CHECK_EQUAL(32, pool.Reserved());
+  BOOST_CHECK_EQUAL(20, pool.Requested());
+  // Doesn't fit in the 12 left, which are wasted.
+  pool.Allocate(20);
+  BOOST_CHECK_EQUAL(32 + 64, pool.Reserved());
+  BOOST_CHECK_EQUAL(40, pool.Requested());
+  BOOST_CHECK_EQUAL(12, pool.Wasted());
+  // Bigger than the next block.
+  pool.Allocate(1000);
+  BOOST_CHECK_EQUAL(32 + 64 + 1000, pool.Reserved());
+  BOOST_CHECK_EQUAL(1040, pool.Requested());
+  BOOST_CHECK_EQUAL(12 + 44, pool.Wasted());
+  pool.FreeAll();
+  BOOST_CHECK_EQUAL(0, pool.Reserved());
+  BOOST_CHECK_EQUAL(0, pool.Requested());
+  BOOST_CHECK_EQUAL(0, pool.Wasted());
+  pool.Allocate(1);
+  BOOST_CHECK_EQUAL(32, pool.Reserved());
+}
+
+BOOST_AUTO_TEST_CASE(max_block) {
+  Pool pool(100, 300);
+  std::size_t expect[] = {100, 200, 300, 300};
+  std::size_t total = 0;
+  for (std::size_t i = 0; i < 4; ++i) {
+    pool.Allocate(expect[i]);
+    total += expect[i];
+    BOOST_CHECK_EQUAL(total, pool.Reserved());
+    BOOST_CHECK_EQUAL(total, pool.Requested());
+    BOOST_CHECK_EQUAL(0, pool.Wasted());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(continue_block) {
+  Pool pool(64, 64);
+  void *base = pool.Allocate(40);
+  BOOST_CHECK(!pool.Continue(base, 20));
+  BOOST_CHECK_EQUAL(60, pool.Requested());
+  // The 60 bytes so far move to a new block and the old one is wasted.
+  BOOST_CHECK(pool.Continue(base, 10));
+  BOOST_CHECK_EQUAL(64 + 70, pool.Reserved());
+  BOOST_CHECK_EQUAL(64, pool.Wasted());
+  BOOST_CHECK_EQUAL(70, pool.Requested());
+}
+
+// Boost.Test checks aren't thread safe, so this records what to check.
+void AllocateIn(ThreadLocalPool *pools, Pool **got, std::size_t size) {
+  got[0] = &pools->Local();
+  for (std::size_t i = 0; i < 10; ++i) {
+    got[0]->Allocate(size);
+  }
+  got[1] = &pools->Local();
+}
+
+BOOST_AUTO_TEST_CASE(thread_local_pool) {
+  ThreadLocalPool pools(1024, 1024);
+  Pool *got[3][2];
+  boost::thread_group threads;
+  for (std::size_t t = 0; t < 3; ++t) {
+    threads.create_thread(boost::bind(&AllocateIn, &pools, got[t], t + 1));
+  }
+  threads.join_all();
+  for (std::size_t t = 0; t < 3; ++t) {
+    BOOST_CHECK_EQUAL(got[t][0], got[t][1]);
+  }
+  BOOST_CHECK(got[0][0] != got[1][0] && got[1][0] != got[2][0] && got[0][0] != got[2][0]);
+  BOOST_CHECK(&pools.Local() != got[0][0]);
+  BOOST_CHECK_EQUAL(60, pools.Requested());
+  BOOST_CHECK_EQUAL(3 * 1024, pools.Reserved());
+  BOOST_CHECK_EQUAL(0, pools.Wasted());
+}
+
+} // namespace
+} // namespace util
@@ -2,6 +2,7 @@
 #define UTIL_PROBING_HASH_TABLE_H
 
 #include "util/exception.hh"
+#include "util/mmap.hh"
 #include "util/scoped.hh"
 
 #include <algorithm>
@@ -12,6 +13,12 @@
 #include <assert.h>
 #include <stdint.h>
 
+#if defined(__GNUC__)
+#define UTIL_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define UTIL_PREFETCH(address)
+#endif
+
 namespace util {
 
 /* Thrown when table grows too large */
@@ -27,6 +34,7 @@ struct IdentityHash {
 };
 
 template <class EntryT, class HashT, class EqualT> class AutoProbing;
+template <class EntryT, class HashT, class EqualT> class IncrementalProbing;
 
 /* Non-standard hash table
  * Buckets must be set at the beginning and must be greater than maximum number
@@ -51,7 +59,7 @@ template <class EntryT, class HashT, class EqualT = std::equal_to<typename Entry
     }
 
     // Must be assigned to later.  
-    ProbingHashTable() : entries_(0)
+    ProbingHashTable() : begin_(NULL), buckets_(0), end_(NULL), entries_(0)
 #ifdef DEBUG
       , initialized_(false)
 #endif
@@ -103,6 +111,27 @@ template <class EntryT, class HashT, class EqualT = std::equal_to<typename Entry
 
     void FinishedInserting() {}
 
+    // Hint that key will be looked up soon.
+    template <class Key> void Prefetch(const Key key) const {
+      UTIL_PREFETCH(begin_ + (hash_(key) % buckets_));
+    }
+
+    /* Look up count keys, prefetching all their home buckets first so the
+     * cache misses overlap.  found[i] is whether keys[i] is present and, if
+     * so, out[i] points to it.
+     */
+    template <class Key> void FindBatch(const Key *keys, std::size_t count, ConstIterator *out, bool *found) const {
+      for (std::size_t i = 0; i < count; ++i) Prefetch(keys[i]);
+      for (std::size_t i = 0; i < count; ++i) found[i] = Find(keys[i], out[i]);
+    }
+
+    // FindOrInsert each entry in order after prefetching them all.  A key
+    // repeated in the batch is inserted by its first occurrence.
+    template <class T> void FindOrInsertBatch(const T *entries, std::size_t count, MutableIterator *out, bool *found) {
+      for (std::size_t i = 0; i < count; ++i) Prefetch(entries[i].GetKey());
+      for (std::size_t i = 0; i < count; ++i) found[i] = FindOrInsert(entries[i], out[i]);
+    }
+
     // Don't change anything related to GetKey,  
     template <class Key> bool UnsafeMutableFind(const Key key, MutableIterator &out) {
 #ifdef DEBUG
@@ -229,6 +258,7 @@ template <class EntryT, class HashT, class EqualT = std::equal_to<typename Entry
 
   private:
     friend class AutoProbing<Entry, Hash, Equal>;
+    friend class IncrementalProbing<Entry, Hash, Equal>;
 
     template <class T> MutableIterator Ideal(const T &t) {
       return begin_ + (hash_(t.GetKey()) % buckets_);
@@ -265,8 +295,10 @@ template <class EntryT, class HashT, class EqualT = std::equal_to<typename Entry
     typedef HashT Hash;
     typedef EqualT Equal;
 
+    // Memory comes from HugeMalloc and HugeRealloc, so large tables use huge
+    // pages and grow with mremap.
     AutoProbing(std::size_t initial_size = 10, const Key &invalid = Key(), const Hash &hash_func = Hash(), const Equal &equal_func = Equal()) :
-      allocated_(Backend::Size(initial_size, 1.5)), mem_(util::MallocOrThrow(allocated_)), backend_(mem_.get(), allocated_, invalid, hash_func, equal_func) {
+      allocated_(Backend::Size(initial_size, 1.5)), mem_(allocated_, false), backend_(mem_.get(), allocated_, invalid, hash_func, equal_func), interleave_(false) {
       threshold_ = initial_size * 1.2;
       Clear();
     }
@@ -298,6 +330,20 @@ template <class EntryT, class HashT, class EqualT = std::equal_to<typename Entry
       return backend_.MustFind(key);
     }
 
+    template <class Key> void Prefetch(const Key key) const {
+      backend_.Prefetch(key);
+    }
+
+    template <class Key> void FindBatch(const Key *keys, std::size_t count, ConstIterator *out, bool *found) const {
+      backend_.FindBatch(keys, count, out, found);
+    }
+
+    // Grows first if needed so every out stays valid.
+    template <class T> void FindOrInsertBatch(const T *entries, std::size_t count, MutableIterator *out, bool *found) {
+      Reserve(Size() + count);
+      backend_.FindOrInsertBatch(entries, count, out, found);
+    }
+
     std::size_t Size() const {
       return backend_.SizeNoSerialization();
     }
@@ -306,20 +352,214 @@ template <class EntryT, class HashT, class EqualT = std::equal_to<typename Entry
       backend_.Clear();
     }
 
+    // Bytes allocated for entries.
+    std::size_t MemoryUsage() const {
+      return allocated_;
+    }
+
+    // Grow now so that entries fit without doubling later.
+    void Reserve(std::size_t entries) {
+      while (threshold_ < entries) Double();
+    }
+
+    /* Interleave the table's pages across NUMA nodes, for tables probed by
+     * threads on several nodes.  Applies to pages not yet touched, including
+     * all memory from later doublings, and only once the table is big enough
+     * to be mmapped.  Call Reserve first to cover the whole table.
+     */
+    void InterleaveNUMA() {
+      interleave_ = true;
+      util::InterleaveNUMA(mem_);
+    }
+
   private:
     void DoubleIfNeeded() {
       if (Size() < threshold_)
         return;
-      mem_.call_realloc(backend_.DoubleTo());
+      Double();
+    }
+
+    void Double() {
+      HugeRealloc(backend_.DoubleTo(), false, mem_);
+      if (interleave_) util::InterleaveNUMA(mem_);
       allocated_ = backend_.DoubleTo();
       backend_.Double(mem_.get());
       threshold_ *= 2;
     }
 
     std::size_t allocated_;
-    util::scoped_malloc mem_;
+    util::scoped_memory mem_;
     Backend backend_;
     std::size_t threshold_;
+    bool interleave_;
+};
+
+/* Like AutoProbing but grows without stopping the world.  On reaching the
+ * threshold, a table twice the size is allocated and the old one is kept
+ * read-only while each insert copies the next kStepBuckets buckets into the
+ * new one.  That finishes long before the new table fills.  Lookups check
+ * the new table and then the old one, which is intact until it is freed.
+ *
+ * If an all-zero entry is invalid, the new table comes from calloc so its
+ * pages are mapped as they are used rather than all cleared at once.  Memory
+ * peaks at the old table plus the new one, the same as realloc when it has to
+ * copy.  Iterators are invalidated by any insert.
+ */
+template <class EntryT, class HashT, class EqualT = std::equal_to<typename EntryT::Key> > class IncrementalProbing {
+  private:
+    typedef ProbingHashTable<EntryT, HashT, EqualT> Backend;
+  public:
+    typedef EntryT Entry;
+    typedef typename Entry::Key Key;
+    typedef const Entry *ConstIterator;
+    typedef Entry *MutableIterator;
+    typedef HashT Hash;
+    typedef EqualT Equal;
+
+    IncrementalProbing(std::size_t initial_size = 10, const Key &invalid = Key(), const Hash &hash_func = Hash(), const Equal &equal_func = Equal()) :
+      invalid_(invalid), hash_(hash_func), equal_(equal_func), zero_is_invalid_(equal_func(Key(), invalid)),
+      allocated_(Backend::Size(initial_size, 1.5)), mem_(util::MallocOrThrow(allocated_)), backend_(mem_.get(), allocated_, invalid, hash_func, equal_func),
+      old_allocated_(0), migrated_(0), size_(0) {
+      threshold_ = initial_size * 1.2;
+      backend_.Clear();
+    }
+
+    // Assumes that the key is unique.
+    template <class T> MutableIterator Insert(const T &t) {
+      Step();
+      ++size_;
+      return backend_.UncheckedInsert(t);
+    }
+
+    template <class T> bool FindOrInsert(const T &t, MutableIterator &out) {
+      Step();
+      if (Migrating()) {
+        if (backend_.UnsafeMutableFind(t.GetKey(), out)) return true;
+        // Not copied yet.  Changes to it will be copied.
+        if (old_.UnsafeMutableFind(t.GetKey(), out)) return true;
+        ++size_;
+        out = backend_.UncheckedInsert(t);
+        return false;
+      }
+      if (backend_.FindOrInsert(t, out)) return true;
+      ++size_;
+      return false;
+    }
+
+    template <class Key> bool UnsafeMutableFind(const Key key, MutableIterator &out) {
+      return backend_.UnsafeMutableFind(key, out) || (Migrating() && old_.UnsafeMutableFind(key, out));
+    }
+
+    template <class Key> bool Find(const Key key, ConstIterator &out) const {
+      return backend_.Find(key, out) || (Migrating() && old_.Find(key, out));
+    }
+
+    // Entries only move to the new table so that is where to look first.
+    template <class Key> void Prefetch(const Key key) const {
+      backend_.Prefetch(key);
+    }
+
+    // There is no FindOrInsertBatch because finishing a migration would
+    // invalidate iterators into the old table.
+    template <class Key> void FindBatch(const Key *keys, std::size_t count, ConstIterator *out, bool *found) const {
+      for (std::size_t i = 0; i < count; ++i) Prefetch(keys[i]);
+      for (std::size_t i = 0; i < count; ++i) found[i] = Find(keys[i], out[i]);
+    }
+
+    std::size_t Size() const {
+      return size_;
+    }
+
+    void Clear() {
+      FinishMigration();
+      backend_.Clear();
+      size_ = 0;
+    }
+
+    // Bytes allocated for entries, including a table being copied from.
+    std::size_t MemoryUsage() const {
+      return allocated_ + old_allocated_;
+    }
+
+    bool Migrating() const { return old_allocated_ != 0; }
+
+    // Copy everything that is left in one go.
+    void FinishMigration() {
+      if (Migrating()) Migrate(old_allocated_ / sizeof(Entry));
+    }
+
+    // Grow now, all at once, so that entries fit without growing later.
+    void Reserve(std::size_t entries) {
+      FinishMigration();
+      if (threshold_ >= entries) return;
+      Start(Backend::Size(entries, 1.5));
+      threshold_ = entries * 1.2;
+      FinishMigration();
+    }
+
+  private:
+    // Buckets copied per insert.  The old table has 1.25 buckets per entry
+    // at the threshold and there are as many inserts before the next one.
+    static const std::size_t kStepBuckets = 4;
+
+    void Step() {
+      if (Migrating()) Migrate(kStepBuckets);
+      if (size_ >= threshold_) {
+        FinishMigration();
+        Start(allocated_ * 2);
+        threshold_ *= 2;
+      }
+    }
+
+    void Start(std::size_t allocate) {
+      old_mem_.reset(mem_.release());
+      old_allocated_ = allocated_;
+      old_ = backend_;
+      allocated_ = allocate;
+      if (zero_is_invalid_) {
+        // Large calloc maps zero pages lazily instead of writing them now.
+        mem_.reset(util::CallocOrThrow(allocated_));
+        backend_ = Backend(mem_.get(), allocated_, invalid_, hash_, equal_);
+      } else {
+        mem_.reset(util::MallocOrThrow(allocated_));
+        backend_ = Backend(mem_.get(), allocated_, invalid_, hash_, equal_);
+        backend_.Clear();
+      }
+      migrated_ = 0;
+    }
+
+    void Migrate(std::size_t buckets) {
+      const Entry *from = static_cast<const Entry*>(old_mem_.get());
+      std::size_t end = std::min(old_allocated_ / sizeof(Entry), migrated_ + buckets);
+      for (; migrated_ < end; ++migrated_) {
+        if (!equal_(from[migrated_].GetKey(), invalid_)) backend_.UncheckedInsert(from[migrated_]);
+      }
+      if (migrated_ == old_allocated_ / sizeof(Entry)) {
+        old_mem_.reset();
+        old_allocated_ = 0;
+        old_ = Backend();
+      }
+    }
+
+    const Key invalid_;
+    const Hash hash_;
+    const Equal equal_;
+    // Whether zeroed memory is a table of empty buckets.  Keys are integers
+    // or PODs of them, so a value-initialized key is all zero bytes.  Entry
+    // itself may have a constructor that leaves the key unset.
+    const bool zero_is_invalid_;
+
+    std::size_t allocated_;
+    util::scoped_malloc mem_;
+    Backend backend_;
+
+    // Table being copied from and the next bucket of it to copy.
+    std::size_t old_allocated_;
+    util::scoped_malloc old_mem_;
+    Backend old_;
+    std::size_t migrated_;
+
+    std::size_t size_, threshold_;
 };
 
 } // namespace util
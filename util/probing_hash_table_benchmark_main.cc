@@ -0,0 +1,277 @@
+// Compare memory, speed, and pauses of the hash sets used for deduplication.
+// Each table runs in its own process so peak RSS can be reported.
+#include "util/fast_hash.hh"
+#include "util/fingerprint_set.hh"
+#include "util/group_probing_hash_table.hh"
+#include "util/mmap.hh"
+#include "util/murmur_hash.hh"
+#include "util/probing_hash_table.hh"
+#include "util/scoped.hh"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include <stdint.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#endif
+
+namespace util {
+namespace {
+
+struct Entry {
+  typedef uint64_t Key;
+  uint64_t key;
+  uint64_t GetKey() const { return key; }
+  void SetKey(uint64_t to) { key = to; }
+};
+
+double Seconds() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<double>(ts.tv_sec) + static_cast<double>(ts.tv_nsec) * 1e-9;
+}
+
+// Counts this process's dTLB load misses, where the kernel exposes them.
+class TLBMisses {
+  public:
+    TLBMisses() : fd_(-1) {
+#if defined(__linux__) && defined(SYS_perf_event_open)
+      struct perf_event_attr attr;
+      memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = PERF_TYPE_HW_CACHE;
+      attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      fd_ = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+    }
+
+    ~TLBMisses() {
+      if (fd_ >= 0) close(fd_);
+    }
+
+    uint64_t Read() const {
+      uint64_t ret = 0;
+      if (fd_ >= 0 && read(fd_, &ret, sizeof(ret)) != sizeof(ret)) ret = 0;
+      return ret;
+    }
+
+    // Print misses per operation since before, or n/a.
+    void Report(uint64_t before, uint64_t ops, std::ostream &to) const {
+      if (fd_ < 0) {
+        to << "n/a";
+      } else {
+        to << (static_cast<double>(Read() - before) / static_cast<double>(ops));
+      }
+    }
+
+  private:
+    int fd_;
+};
+
+long MinorFaults() {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_minflt;
+}
+
+// Like dedupe: hashes of lines, about every (entries / distinct)th one new.
+uint64_t Key(uint64_t i, uint64_t distinct) {
+  uint64_t value = i % distinct;
+  return MurmurHash64A(&value, sizeof(value)) + 1;
+}
+
+template <class Table> class ProbingAdapter {
+  public:
+    bool FindOrInsert(uint64_t key) {
+      Entry entry;
+      entry.key = key;
+      typename Table::MutableIterator it;
+      return table_.FindOrInsert(entry, it);
+    }
+    std::size_t Size() const { return table_.Size(); }
+    std::size_t MemoryUsage() const { return table_.MemoryUsage(); }
+  private:
+    Table table_;
+};
+
+typedef ProbingAdapter<AutoProbing<Entry, IdentityHash> > Probing;
+typedef ProbingAdapter<IncrementalProbing<Entry, IdentityHash> > Incremental;
+typedef ProbingAdapter<AutoGroupProbing<Entry, IdentityHash> > Group;
+
+class Fingerprint : public FingerprintSet {
+  public:
+    Fingerprint() : FingerprintSet(48) {}
+};
+
+template <class Set> void Run(const char *name, uint64_t entries, uint64_t distinct) {
+  Set set;
+  uint64_t found = 0;
+  TLBMisses tlb;
+  uint64_t tlb_before = tlb.Read();
+  long faults = MinorFaults();
+  double start = Seconds(), longest = 0.0, before = start;
+  for (uint64_t i = 0; i < entries; ++i) {
+    found += set.FindOrInsert(Key(i, distinct));
+    double after = Seconds();
+    longest = std::max(longest, after - before);
+    before = after;
+  }
+  double seconds = Seconds() - start;
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  std::cout << name << '\t' << seconds << " s\t" << (seconds * 1e9 / static_cast<double>(entries)) << " ns/op\t"
+    << (longest * 1e3) << " ms max pause\t"
+    << set.MemoryUsage() << " bytes\t" << (static_cast<double>(set.MemoryUsage()) / static_cast<double>(set.Size())) << " bytes/unique\t"
+    << usage.ru_maxrss << " kB peak RSS\t"
+    << (usage.ru_minflt - faults) << " page faults\t";
+  tlb.Report(tlb_before, entries, std::cout);
+  std::cout << " dTLB misses/op\t" << found << " found" << std::endl;
+}
+
+template <class Set> void Fork(const char *name, uint64_t entries, uint64_t distinct) {
+  pid_t pid = fork();
+  if (pid == 0) {
+    Run<Set>(name, entries, distinct);
+    std::exit(0);
+  }
+  int status;
+  waitpid(pid, &status, 0);
+}
+
+// Fill a fixed size table to load and time inserts, hits, misses, and hits
+// looked up with FindBatch.  The memory comes from malloc or, with huge,
+// HugeMalloc as AutoProbing does.
+template <class Table> void Load(const char *name, std::size_t slots, std::size_t allocated, float load, bool huge) {
+  scoped_memory mem;
+  if (huge) {
+    HugeMalloc(allocated, false, mem);
+  } else {
+    mem.reset(MallocOrThrow(allocated), allocated, scoped_memory::MALLOC_ALLOCATED);
+  }
+  long faults = MinorFaults();
+  Table table(mem.get(), allocated);
+  table.Clear();
+  uint64_t entries = static_cast<uint64_t>(load * static_cast<float>(slots));
+  Entry entry;
+  typename Table::MutableIterator it;
+  double start = Seconds();
+  for (uint64_t i = 0; i < entries; ++i) {
+    entry.key = Key(i, ~static_cast<uint64_t>(0));
+    table.FindOrInsert(entry, it);
+  }
+  double inserted = Seconds();
+  faults = MinorFaults() - faults;
+  typename Table::ConstIterator found;
+  uint64_t hits = 0;
+  TLBMisses tlb;
+  uint64_t tlb_before = tlb.Read();
+  for (uint64_t i = 0; i < entries; ++i) {
+    hits += table.Find(Key(i, ~static_cast<uint64_t>(0)), found);
+  }
+  double hit = Seconds();
+  std::ostringstream tlb_hit;
+  tlb.Report(tlb_before, entries, tlb_hit);
+  for (uint64_t i = entries; i < 2 * entries; ++i) {
+    hits += table.Find(Key(i, ~static_cast<uint64_t>(0)), found);
+  }
+  double miss = Seconds();
+  const std::size_t kBatch = 64;
+  uint64_t keys[kBatch];
+  typename Table::ConstIterator outs[kBatch];
+  bool founds[kBatch];
+  for (uint64_t i = 0; i + kBatch <= entries; i += kBatch) {
+    for (std::size_t j = 0; j < kBatch; ++j) keys[j] = Key(i + j, ~static_cast<uint64_t>(0));
+    table.FindBatch(keys, kBatch, outs, founds);
+    for (std::size_t j = 0; j < kBatch; ++j) hits += founds[j];
+  }
+  double batch = Seconds();
+  double scale = 1e9 / static_cast<double>(entries);
+  std::cout << name << (huge ? "-huge" : "") << '\t' << load << " load\t" << ((inserted - start) * scale) << " ns/insert\t"
+    << ((hit - inserted) * scale) << " ns/hit\t" << ((miss - hit) * scale) << " ns/miss\t"
+    << ((batch - miss) * scale) << " ns/batched hit\t" << faults << " page faults\t"
+    << tlb_hit.str() << " dTLB misses/hit\t" << hits << " found" << std::endl;
+}
+
+void LoadFactors(std::size_t slots) {
+  typedef ProbingHashTable<Entry, IdentityHash> Probing;
+  typedef GroupProbingHashTable<Entry, IdentityHash> Group;
+  for (unsigned tenths = 5; tenths <= 9; ++tenths) {
+    float load = static_cast<float>(tenths) / 10.0;
+    for (unsigned huge = 0; huge < 2; ++huge) {
+      Load<Probing>("probing", slots, slots * sizeof(Entry), load, huge);
+      Load<Group>("group", slots, Group::SizeForSlots(slots), load, huge);
+    }
+  }
+}
+
+// Time string hashes on about 1 GB of input split into pieces of each length.
+template <class Hasher> void HashLength(const char *name, const std::vector<char> &data, std::size_t length) {
+  Hasher hasher;
+  uint64_t sum = 0;
+  std::size_t count = (static_cast<std::size_t>(1) << 30) / length;
+  const char *end = &data[0] + data.size() - length;
+  double start = Seconds();
+  const char *p = &data[0];
+  for (std::size_t i = 0; i < count; ++i) {
+    sum += hasher(p, length);
+    p += length;
+    if (p > end) p = &data[0];
+  }
+  double seconds = Seconds() - start;
+  std::cout << name << '\t' << length << " bytes\t" << (seconds * 1e9 / static_cast<double>(count)) << " ns/hash\t"
+    << (static_cast<double>(count * length) / seconds / 1e9) << " GB/s\t" << sum << std::endl;
+}
+
+void Hashes() {
+  std::vector<char> data(1 << 20);
+  for (std::size_t i = 0; i < data.size(); ++i) data[i] = static_cast<char>(Key(i, ~static_cast<uint64_t>(0)));
+  std::cout << "FastHash AVX2: " << FastHashUsesAVX2() << std::endl;
+  const std::size_t kLengths[] = {8, 24, 64, 200, 1000, 10000};
+  for (const std::size_t *l = kLengths; l != kLengths + sizeof(kLengths) / sizeof(std::size_t); ++l) {
+    HashLength<MurmurHasher>("murmur", data, *l);
+    HashLength<FastHasher>("fast", data, *l);
+  }
+}
+
+} // namespace
+} // namespace util
+
+int main(int argc, char *argv[]) {
+  if (argc >= 2 && !strcmp(argv[1], "--load")) {
+    util::LoadFactors(static_cast<std::size_t>(1) << (argc == 3 ? std::atoi(argv[2]) : 24));
+    return 0;
+  }
+  if (argc == 2 && !strcmp(argv[1], "--hash")) {
+    util::Hashes();
+    return 0;
+  }
+  if (argc < 2 || argc > 3) {
+    std::cerr << "Usage: " << argv[0] << " entries [distinct]\n"
+      "Inserts hashes of entries values of which distinct are different.\n"
+      "Usage: " << argv[0] << " --load [log2 slots]\n"
+      "Times fixed size tables at load factors 0.5 to 0.9, in memory from\n"
+      "malloc and from HugeMalloc.\n"
+      "Usage: " << argv[0] << " --hash\n"
+      "Times MurmurHash and FastHash on strings of several lengths.\n";
+    return 1;
+  }
+  uint64_t entries = std::strtoull(argv[1], NULL, 10);
+  uint64_t distinct = argc == 3 ? std::strtoull(argv[2], NULL, 10) : entries;
+  util::Fork<util::Probing>("probing", entries, distinct);
+  util::Fork<util::Incremental>("incremental", entries, distinct);
+  util::Fork<util::Group>("group", entries, distinct);
+  util::Fork<util::Fingerprint>("fingerprint48", entries, distinct);
+}
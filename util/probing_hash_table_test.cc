@@ -98,5 +98,96 @@ BOOST_AUTO_TEST_CASE(Double) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(Reserve) {
+  AutoProbing<Entry64, MurmurHashEntry64> table(10, std::numeric_limits<uint64_t>::max());
+  table.Reserve(1000);
+  std::size_t memory = table.MemoryUsage();
+  AutoProbing<Entry64, MurmurHashEntry64>::MutableIterator it = NULL;
+  for (uint64_t i = 0; i < 1000; ++i) {
+    BOOST_REQUIRE(!table.FindOrInsert(Entry64(i), it));
+  }
+  BOOST_CHECK_EQUAL(memory, table.MemoryUsage());
+  AutoProbing<Entry64, MurmurHashEntry64>::ConstIterator found = NULL;
+  for (uint64_t i = 0; i < 1000; ++i) {
+    BOOST_REQUIRE(table.Find(i, found));
+  }
+}
+
+// Doubling moves the table from malloc to huge pages and then grows it with
+// mremap.  Entries must survive each step.
+BOOST_AUTO_TEST_CASE(HugeDoubling) {
+  AutoProbing<Entry64, MurmurHashEntry64> table(10, std::numeric_limits<uint64_t>::max());
+  table.InterleaveNUMA();
+  AutoProbing<Entry64, MurmurHashEntry64>::MutableIterator it = NULL;
+  const uint64_t kCount = 400000;
+  for (uint64_t i = 0; i < kCount; ++i) {
+    BOOST_REQUIRE(!table.FindOrInsert(Entry64(i), it));
+  }
+  BOOST_CHECK_GT(table.MemoryUsage(), static_cast<std::size_t>(4) << 20);
+  AutoProbing<Entry64, MurmurHashEntry64>::ConstIterator found = NULL;
+  for (uint64_t i = 0; i < kCount; ++i) {
+    BOOST_REQUIRE(table.Find(i, found));
+  }
+  BOOST_CHECK(!table.Find(kCount, found));
+}
+
+// The first of repeated keys in a batch is inserted; the rest find it.
+BOOST_AUTO_TEST_CASE(Batch) {
+  AutoProbing<Entry64, MurmurHashEntry64> table(10, std::numeric_limits<uint64_t>::max());
+  Entry64 entries[100];
+  for (uint64_t i = 0; i < 100; ++i) entries[i] = Entry64(i % 30);
+  AutoProbing<Entry64, MurmurHashEntry64>::MutableIterator its[100];
+  bool found[100];
+  table.FindOrInsertBatch(entries, 100, its, found);
+  for (uint64_t i = 0; i < 100; ++i) {
+    BOOST_CHECK_EQUAL(i >= 30, found[i]);
+    BOOST_CHECK_EQUAL(i % 30, its[i]->GetKey());
+  }
+  BOOST_CHECK_EQUAL(30, table.Size());
+  uint64_t keys[40];
+  for (uint64_t i = 0; i < 40; ++i) keys[i] = i;
+  AutoProbing<Entry64, MurmurHashEntry64>::ConstIterator outs[40];
+  table.FindBatch(keys, 40, outs, found);
+  for (uint64_t i = 0; i < 40; ++i) {
+    BOOST_REQUIRE_EQUAL(i < 30, found[i]);
+    if (found[i]) BOOST_CHECK_EQUAL(i, outs[i]->GetKey());
+  }
+}
+
+// Everything is found while the table is migrating and after.
+BOOST_AUTO_TEST_CASE(Incremental) {
+  typedef IncrementalProbing<Entry64, MurmurHashEntry64> Incremental;
+  Incremental table(10, std::numeric_limits<uint64_t>::max());
+  Incremental::MutableIterator it = NULL;
+  Incremental::ConstIterator found = NULL;
+  bool migrated = false;
+  for (uint64_t i = 0; i < 10000; ++i) {
+    BOOST_REQUIRE(!table.FindOrInsert(Entry64(i), it));
+    BOOST_REQUIRE_EQUAL(i, it->GetKey());
+    BOOST_REQUIRE(table.FindOrInsert(Entry64(i / 2), it));
+    BOOST_REQUIRE_EQUAL(i / 2, it->GetKey());
+    if (table.Migrating() && i % 97 == 0) {
+      migrated = true;
+      for (uint64_t j = 0; j <= i; ++j) {
+        BOOST_REQUIRE(table.Find(j, found));
+        BOOST_REQUIRE_EQUAL(j, found->GetKey());
+      }
+      BOOST_REQUIRE(!table.Find(i + 1, found));
+    }
+  }
+  BOOST_CHECK(migrated);
+  BOOST_CHECK_EQUAL(10000, table.Size());
+  table.FinishMigration();
+  BOOST_CHECK(!table.Migrating());
+  for (uint64_t i = 0; i < 10000; ++i) {
+    BOOST_REQUIRE(table.Find(i, found));
+  }
+  table.Reserve(100000);
+  BOOST_CHECK(!table.Migrating());
+  for (uint64_t i = 0; i < 10000; ++i) {
+    BOOST_REQUIRE(table.Find(i, found));
+  }
+}
+
 } // namespace
 } // namespace util
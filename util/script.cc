@@ -0,0 +1,81 @@
+#include "util/script.hh"
+
+namespace utf8 {
+
+namespace {
+
+inline unsigned LowestBit(uint64_t mask) {
+#if defined(__GNUC__)
+  return __builtin_ctzll(mask);
+#else
+  unsigned ret = 0;
+  for (; !(mask & 1); mask >>= 1) ++ret;
+  return ret;
+#endif
+}
+
+// Counter for CountScripts that fills ScriptCounts.
+class AllScripts {
+  public:
+    AllScripts(std::size_t *counts, uint64_t *seen) : counts_(counts), seen_(seen), latin_(0), common_(0), other_(0), angle_(0) {}
+
+    void ASCII(std::size_t count, std::size_t letters, std::size_t angle) {
+      latin_ += letters;
+      common_ += count - letters;
+      angle_ += angle;
+    }
+
+    void Add(UScriptCode script) {
+      if (!counts_[script]++) Seen(script);
+      ++other_;
+    }
+
+    // Adds the ASCII and returns the total.
+    std::size_t Finish() {
+      counts_[USCRIPT_LATIN] += latin_;
+      if (latin_) Seen(USCRIPT_LATIN);
+      counts_[USCRIPT_COMMON] += common_;
+      if (common_) Seen(USCRIPT_COMMON);
+      return latin_ + common_ + other_;
+    }
+
+    std::size_t Angle() const { return angle_; }
+
+  private:
+    void Seen(UScriptCode script) {
+      seen_[script / 64] |= static_cast<uint64_t>(1) << (script % 64);
+    }
+
+    std::size_t *const counts_;
+    uint64_t *const seen_;
+    std::size_t latin_, common_, other_, angle_;
+};
+
+} // namespace
+
+ScriptCounts::ScriptCounts()
+  : counts_(kScriptLimit), seen_(counts_.size() / 64 + 1), total_(0), angle_(0) {}
+
+bool ScriptCounts::Count(const StringPiece &line) {
+  for (std::size_t word = 0; word < seen_.size(); ++word) {
+    for (; seen_[word]; seen_[word] &= seen_[word] - 1) {
+      counts_[word * 64 + LowestBit(seen_[word])] = 0;
+    }
+  }
+  AllScripts counter(&counts_[0], &seen_[0]);
+  bool ret = CountScripts(line, counter);
+  total_ = counter.Finish();
+  angle_ = counter.Angle();
+  return ret;
+}
+
+void ScriptCounts::Present(std::vector<UScriptCode> &out) const {
+  out.clear();
+  for (std::size_t word = 0; word < seen_.size(); ++word) {
+    for (uint64_t bits = seen_[word]; bits; bits &= bits - 1) {
+      out.push_back(static_cast<UScriptCode>(word * 64 + LowestBit(bits)));
+    }
+  }
+}
+
+} // namespace utf8
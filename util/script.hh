@@ -0,0 +1,131 @@
+#ifndef UTIL_SCRIPT__
+#define UTIL_SCRIPT__
+
+/* Counting the characters of a line by script.  Scripts come from the tables
+ * in util/unicode_properties.hh, so they follow the Unicode version of those
+ * tables rather than the ICU linked in.
+ */
+
+#include "util/have.hh"
+#include "util/string_piece.hh"
+#include "util/unicode_properties.hh"
+
+#include <unicode/uscript.h>
+#include <unicode/utf8.h>
+#include <unicode/utypes.h>
+
+#include <vector>
+
+#include <stdint.h>
+
+#ifdef HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace utf8 {
+
+namespace detail {
+inline unsigned CountBits(unsigned mask) {
+#if defined(__GNUC__)
+  return __builtin_popcount(mask);
+#else
+  unsigned ret = 0;
+  for (; mask; mask &= mask - 1) ++ret;
+  return ret;
+#endif
+}
+
+// Counts printable ASCII 16 bytes at a time from data[offset].  Stops at the
+// first block with non-ASCII or too little left.  Returns false on a control
+// character.
+template <class Counter> inline bool CountASCIIBlocks(const char *data, int32_t &offset, int32_t length, Counter &counter) {
+#ifdef HAVE_SSE2
+  const __m128i space = _mm_set1_epi8(' ');
+  const __m128i case_bit = _mm_set1_epi8(0x20);
+  const __m128i before_a = _mm_set1_epi8('a' - 1);
+  const __m128i after_z = _mm_set1_epi8('z' + 1);
+  const __m128i less = _mm_set1_epi8('<');
+  const __m128i greater = _mm_set1_epi8('>');
+  for (; offset + 16 <= length; offset += 16) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset));
+    if (_mm_movemask_epi8(block)) return true;
+    // Without the high bit, signed comparison is fine.
+    if (_mm_movemask_epi8(_mm_cmplt_epi8(block, space))) return false;
+    __m128i folded = _mm_or_si128(block, case_bit);
+    unsigned letters = CountBits(_mm_movemask_epi8(_mm_and_si128(_mm_cmpgt_epi8(folded, before_a), _mm_cmplt_epi8(folded, after_z))));
+    counter.ASCII(16, letters, CountBits(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, less), _mm_cmpeq_epi8(block, greater)))));
+  }
+#endif
+  return true;
+}
+} // namespace detail
+
+/* Feeds the characters of line to counter by script.  Counter must have
+ *   void ASCII(std::size_t count, std::size_t letters, std::size_t angle);
+ *   void Add(UScriptCode script);
+ * ASCII comes in bulk: of count characters, the letters are Latin and the
+ * rest are Common, angle of them '<' or '>'.  Returns false, having fed
+ * part of the line, if line has invalid UTF-8 or a control character (below
+ * space).
+ *
+ * This is a template so a counter that keeps a few sums keeps them in
+ * registers.
+ */
+template <class Counter> bool CountScripts(const StringPiece &line, Counter &counter) {
+  const char *data = line.data();
+  int32_t offset = 0;
+  int32_t length = static_cast<int32_t>(line.size());
+  while (offset < length) {
+    if (!detail::CountASCIIBlocks(data, offset, length, counter)) return false;
+    if (offset == length) break;
+    unsigned char byte = static_cast<unsigned char>(data[offset]);
+    if (byte < 0x80) {
+      if (byte < 32) return false;
+      bool letter = static_cast<unsigned char>((byte | 0x20) - 'a') < 26;
+      counter.ASCII(1, letter, (byte == '<') | (byte == '>'));
+      ++offset;
+      continue;
+    }
+    UChar32 character;
+    U8_NEXT(data, offset, length, character);
+    if (character < 32) return false;
+    UScriptCode script = Script(character);
+    if (script == USCRIPT_INVALID_CODE) return false;
+    counter.Add(script);
+  }
+  return true;
+}
+
+// Characters per script in a line, for when every script matters.  Reused
+// from line to line without clearing every script.
+class ScriptCounts {
+  public:
+    ScriptCounts();
+
+    /* Replaces the counts with those of line.  Returns false if line has
+     * invalid UTF-8 or a control character (below space), in which case the
+     * counts are meaningless.
+     */
+    bool Count(const StringPiece &line);
+
+    std::size_t Get(UScriptCode script) const { return counts_[script]; }
+
+    // All characters counted.
+    std::size_t Total() const { return total_; }
+
+    // '<' and '>', which are also in USCRIPT_COMMON.
+    std::size_t Angle() const { return angle_; }
+
+    // Replaces out with the scripts that have a nonzero count, by code.
+    void Present(std::vector<UScriptCode> &out) const;
+
+  private:
+    std::vector<std::size_t> counts_;
+    // Bit per script that might have a nonzero count.
+    std::vector<uint64_t> seen_;
+    std::size_t total_, angle_;
+};
+
+} // namespace utf8
+
+#endif // UTIL_SCRIPT__
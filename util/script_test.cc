@@ -0,0 +1,98 @@
+#include "util/script.hh"
+
+#define BOOST_TEST_MODULE ScriptTest
+#include <boost/test/unit_test.hpp>
+
+#include <unicode/uchar.h>
+
+#include <string>
+#include <vector>
+
+namespace utf8 {
+namespace {
+
+UScriptCode ICUScript(UChar32 character) {
+  UErrorCode err = U_ZERO_ERROR;
+  UScriptCode ret = uscript_getScript(character, &err);
+  return U_FAILURE(err) ? USCRIPT_INVALID_CODE : ret;
+}
+
+// Histogram of line the slow way.  Returns false where Count should.
+bool ICUCount(const std::string &line, std::vector<std::size_t> &counts, std::size_t &angle) {
+  counts.assign(u_getIntPropertyMaxValue(UCHAR_SCRIPT) + 1, 0);
+  angle = 0;
+  int32_t offset = 0, length = static_cast<int32_t>(line.size());
+  while (offset < length) {
+    UChar32 character;
+    U8_NEXT(line.data(), offset, length, character);
+    if (character < 32) return false;
+    UScriptCode script = ICUScript(character);
+    if (script == USCRIPT_INVALID_CODE) return false;
+    ++counts[script];
+    if (character == '<' || character == '>') ++angle;
+  }
+  return true;
+}
+
+void CheckCounts(ScriptCounts &counts, const std::string &line) {
+  std::vector<std::size_t> expect;
+  std::size_t angle;
+  bool valid = ICUCount(line, expect, angle);
+  BOOST_REQUIRE_EQUAL(valid, counts.Count(line));
+  if (!valid) return;
+  BOOST_CHECK_EQUAL(angle, counts.Angle());
+  std::size_t total = 0;
+  std::vector<UScriptCode> present;
+  for (std::size_t i = 0; i < expect.size(); ++i) {
+    BOOST_CHECK_EQUAL(expect[i], counts.Get(static_cast<UScriptCode>(i)));
+    total += expect[i];
+    if (expect[i]) present.push_back(static_cast<UScriptCode>(i));
+  }
+  BOOST_CHECK_EQUAL(total, counts.Total());
+  std::vector<UScriptCode> got;
+  counts.Present(got);
+  BOOST_CHECK(present == got);
+}
+
+BOOST_AUTO_TEST_CASE(CountsExamples) {
+  ScriptCounts counts;
+  CheckCounts(counts, "");
+  CheckCounts(counts, "Hello, <b>world</b>!");
+  CheckCounts(counts, "\xd0\x9f\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82 world and a longer ASCII tail to use whole blocks");
+  CheckCounts(counts, "caf\xc3\xa9 \xe4\xb8\xad\xe6\x96\x87 e\xcc\x81 \xf0\xa0\x80\x80 \xf0\x9f\x98\x80");
+  // Counts from the line before must not leak into this one.
+  CheckCounts(counts, "plain");
+  // Control characters and bad UTF-8, in and out of 16-byte blocks.
+  CheckCounts(counts, "tab\tinside");
+  CheckCounts(counts, "0123456789abcdef\x01 after a block");
+  CheckCounts(counts, "bad \xff byte");
+  CheckCounts(counts, "surrogate \xed\xa0\x80");
+  CheckCounts(counts, "after failure");
+}
+
+BOOST_AUTO_TEST_CASE(CountsFuzz) {
+  const char *const kPieces[] = {
+    "a", "Z", " ", "<", ">", ".", "abcdefghijklmnopqrstuvwxyz", "\x7f",
+    "\xc3\xa9", "\xce\xa3", "\xd0\x96", "\xe4\xb8\xad", "\xcc\x81",
+    "\xd8\xa7", "\xf0\x9f\x98\x80", "\xef\xbf\xbf", "\xe2\x80\x94"};
+  const std::size_t kCount = sizeof(kPieces) / sizeof(const char*);
+  ScriptCounts counts;
+  uint32_t state = 1;
+  for (unsigned test = 0; test < 2000; ++test) {
+    std::string line;
+    state = state * 1103515245 + 12345;
+    for (unsigned length = (state >> 16) % 40; length; --length) {
+      state = state * 1103515245 + 12345;
+      line += kPieces[(state >> 16) % kCount];
+    }
+    // Now and then a bad byte or control character.
+    state = state * 1103515245 + 12345;
+    if ((state >> 16) % 8 == 0) {
+      line.insert(line.size() / 2, 1, ((state >> 24) & 1) ? '\x03' : '\xc3');
+    }
+    CheckCounts(counts, line);
+  }
+}
+
+} // namespace
+} // namespace utf8
@@ -0,0 +1,3 @@
+#include "util/unicode_properties.hh"
+
+#include "util/unicode_tables.hh"
@@ -0,0 +1,128 @@
+#ifndef UTIL_UNICODE_PROPERTIES__
+#define UTIL_UNICODE_PROPERTIES__
+
+/* Character properties a tokenizer asks about, without calling ICU for each
+ * code point.  The tables in util/unicode_tables.hh are generated from ICU by
+ * util/unicode_tables_main.cc, so they follow the Unicode version of the ICU
+ * that made them (tables::kUnicodeVersion) rather than the one linked in.
+ */
+
+#include "util/have.hh"
+
+#include <unicode/uscript.h>
+#include <unicode/utypes.h>
+
+#include <stdint.h>
+
+#ifdef HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace utf8 {
+
+// Property flags, each what ICU says.
+// UCHAR_ALPHABETIC, Perl's \p{IsAlpha}.
+const uint8_t kAlpha = 1 << 0;
+// u_isdigit: general category Nd.
+const uint8_t kDigit = 1 << 1;
+// General category N, Perl's \p{IsN}.
+const uint8_t kNumber = 1 << 2;
+// u_ispunct: general category P.
+const uint8_t kPunct = 1 << 3;
+// UCHAR_WHITE_SPACE, Perl's \s.
+const uint8_t kSpace = 1 << 4;
+// UCHAR_POSIX_ALNUM, Perl's \p{IsAlnum}.
+const uint8_t kAlnum = kAlpha | kDigit;
+
+namespace tables {
+extern const char kUnicodeVersion[];
+// Bits of a code point below the stage 1 index and the stage 3 index.
+const unsigned kShift2 = 10;
+const unsigned kShift3 = 4;
+extern const uint8_t kStage1[];
+extern const uint16_t kStage2[];
+// Flags in the high byte, script in the low byte with 0xFF for none.
+extern const uint16_t kStage3[];
+
+inline uint16_t Value(UChar32 character) {
+  uint32_t c = static_cast<uint32_t>(character);
+  if (c >= 0x110000) return 0xFF;
+  uint32_t row = static_cast<uint32_t>(kStage1[c >> kShift2]) << (kShift2 - kShift3);
+  uint32_t block = static_cast<uint32_t>(kStage2[row | ((c >> kShift3) & ((1 << (kShift2 - kShift3)) - 1))]) << kShift3;
+  return kStage3[block | (c & ((1 << kShift3) - 1))];
+}
+} // namespace tables
+
+// Flags of character, or 0 if it's not a code point.
+inline uint8_t PropertyFlags(UChar32 character) {
+  return static_cast<uint8_t>(tables::Value(character) >> 8);
+}
+
+// Whether character has any of the flags in mask, as in HasProperty(c, kAlnum).
+inline bool HasProperty(UChar32 character, uint8_t mask) {
+  return (PropertyFlags(character) & mask) != 0;
+}
+
+// Script returns codes below this, which may be past the last script of an
+// older ICU.
+const unsigned kScriptLimit = 0xFF;
+
+// Same as uscript_getScript, except USCRIPT_INVALID_CODE for what isn't a code
+// point.
+inline UScriptCode Script(UChar32 character) {
+  uint8_t script = static_cast<uint8_t>(tables::Value(character));
+  return script == 0xFF ? USCRIPT_INVALID_CODE : static_cast<UScriptCode>(script);
+}
+
+// Bit i of each mask is byte i of a 16-byte block.
+struct ASCIIClasses {
+  unsigned non_ascii, alpha, digit, punct, space;
+};
+
+// Classifies 16 bytes at once with the same answers as PropertyFlags.  The
+// only ASCII numbers are digits.  Bytes >= 0x80 are only in non_ascii.
+inline void ClassifyASCII(const char *data, ASCIIClasses &out) {
+#ifdef HAVE_SSE2
+  const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+  // Signed comparison leaves bytes >= 0x80 out of every range.
+  const __m128i folded = _mm_or_si128(block, _mm_set1_epi8(0x20));
+  const __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(folded, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(folded, _mm_set1_epi8('z' + 1)));
+  const __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(block, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(block, _mm_set1_epi8('9' + 1)));
+  // Tab through carriage return, and space.
+  const __m128i space = _mm_or_si128(
+      _mm_and_si128(_mm_cmpgt_epi8(block, _mm_set1_epi8('\t' - 1)), _mm_cmplt_epi8(block, _mm_set1_epi8('\r' + 1))),
+      _mm_cmpeq_epi8(block, _mm_set1_epi8(' ')));
+  // Punctuation is the rest of '!' to '~' except the symbols $+<=>^`|~.
+  // Delete is above '~', so it goes with the symbols.
+  const __m128i graphic = _mm_cmpgt_epi8(block, _mm_set1_epi8(' '));
+  __m128i symbol = _mm_cmpeq_epi8(block, _mm_set1_epi8(0x7F));
+  const char kSymbols[] = "$+<=>^`|~";
+  for (const char *s = kSymbols; *s; ++s) {
+    symbol = _mm_or_si128(symbol, _mm_cmpeq_epi8(block, _mm_set1_epi8(*s)));
+  }
+  const __m128i punct = _mm_andnot_si128(_mm_or_si128(_mm_or_si128(alpha, digit), symbol), graphic);
+  out.non_ascii = _mm_movemask_epi8(block);
+  out.alpha = _mm_movemask_epi8(alpha);
+  out.digit = _mm_movemask_epi8(digit);
+  out.punct = _mm_movemask_epi8(punct);
+  out.space = _mm_movemask_epi8(space);
+#else
+  out.non_ascii = out.alpha = out.digit = out.punct = out.space = 0;
+  for (unsigned i = 0; i < 16; ++i) {
+    uint8_t byte = static_cast<uint8_t>(data[i]);
+    if (byte >= 0x80) {
+      out.non_ascii |= 1 << i;
+      continue;
+    }
+    uint8_t flags = PropertyFlags(byte);
+    out.alpha |= static_cast<unsigned>((flags & kAlpha) != 0) << i;
+    out.digit |= static_cast<unsigned>((flags & kDigit) != 0) << i;
+    out.punct |= static_cast<unsigned>((flags & kPunct) != 0) << i;
+    out.space |= static_cast<unsigned>((flags & kSpace) != 0) << i;
+  }
+#endif
+}
+
+} // namespace utf8
+
+#endif // UTIL_UNICODE_PROPERTIES__
@@ -0,0 +1,94 @@
+#include "util/unicode_properties.hh"
+
+#define BOOST_TEST_MODULE UnicodePropertiesTest
+#include <boost/test/unit_test.hpp>
+
+#include <unicode/uchar.h>
+#include <unicode/uversion.h>
+
+#include <string.h>
+
+namespace utf8 {
+namespace {
+
+uint8_t ICUFlags(UChar32 character) {
+  if (character < 0 || character > 0x10FFFF) return 0;
+  uint8_t ret = 0;
+  if (u_hasBinaryProperty(character, UCHAR_ALPHABETIC)) ret |= kAlpha;
+  if (u_isdigit(character)) ret |= kDigit;
+  if (U_GET_GC_MASK(character) & U_GC_N_MASK) ret |= kNumber;
+  if (u_ispunct(character)) ret |= kPunct;
+  if (u_hasBinaryProperty(character, UCHAR_WHITE_SPACE)) ret |= kSpace;
+  return ret;
+}
+
+UScriptCode ICUScript(UChar32 character) {
+  UErrorCode err = U_ZERO_ERROR;
+  UScriptCode ret = uscript_getScript(character, &err);
+  return U_FAILURE(err) ? USCRIPT_INVALID_CODE : ret;
+}
+
+BOOST_AUTO_TEST_CASE(Known) {
+  BOOST_CHECK_EQUAL(kAlpha, PropertyFlags('a'));
+  BOOST_CHECK_EQUAL(kDigit | kNumber, PropertyFlags('7'));
+  BOOST_CHECK_EQUAL(kPunct, PropertyFlags(','));
+  BOOST_CHECK_EQUAL(0, PropertyFlags('$'));
+  BOOST_CHECK_EQUAL(kSpace, PropertyFlags('\t'));
+  BOOST_CHECK_EQUAL(kSpace, PropertyFlags(0x3000));
+  BOOST_CHECK_EQUAL(kNumber, PropertyFlags(0xBD));
+  BOOST_CHECK(HasProperty(0xE9, kAlnum));
+  BOOST_CHECK(HasProperty(0x663, kAlnum));
+  BOOST_CHECK(!HasProperty('-', kAlnum));
+  BOOST_CHECK_EQUAL(USCRIPT_LATIN, Script(0xE9));
+  BOOST_CHECK_EQUAL(USCRIPT_HAN, Script(0x20000));
+  BOOST_CHECK_EQUAL(USCRIPT_INVALID_CODE, Script(-1));
+  BOOST_CHECK_EQUAL(USCRIPT_INVALID_CODE, Script(0x110000));
+  BOOST_CHECK_EQUAL(0, PropertyFlags(0x110000));
+}
+
+// Every code point, including surrogates and out of range values.  If the
+// linked ICU has a newer Unicode than the tables, its new characters are
+// skipped.
+BOOST_AUTO_TEST_CASE(Exhaustive) {
+  UVersionInfo tables, linked;
+  u_versionFromString(tables, tables::kUnicodeVersion);
+  u_getUnicodeVersion(linked);
+  bool same = !memcmp(tables, linked, sizeof(UVersionInfo));
+  if (!same) BOOST_TEST_MESSAGE("Tables have Unicode " << tables::kUnicodeVersion << " but ICU has a different version.");
+  std::size_t wrong = 0;
+  for (UChar32 c = -1; c <= 0x110000; ++c) {
+    if (!same && c >= 0 && c <= 0x10FFFF) {
+      UVersionInfo age;
+      u_charAge(c, age);
+      if (memcmp(age, tables, sizeof(UVersionInfo)) > 0) continue;
+    }
+    if ((PropertyFlags(c) != ICUFlags(c) || Script(c) != ICUScript(c)) && ++wrong < 10) {
+      BOOST_ERROR("Code point " << c << " has flags " << static_cast<unsigned>(PropertyFlags(c)) << " and script " << Script(c) << " but ICU says " << static_cast<unsigned>(ICUFlags(c)) << " and " << ICUScript(c));
+    }
+  }
+  BOOST_CHECK_EQUAL(0, wrong);
+}
+
+// Each byte at each position of a block.
+BOOST_AUTO_TEST_CASE(ClassifyASCIIAll) {
+  char block[16];
+  for (unsigned position = 0; position < 16; ++position) {
+    for (unsigned byte = 0; byte < 256; ++byte) {
+      // Fill the rest with something in no class.
+      memset(block, '$', sizeof(block));
+      block[position] = static_cast<char>(byte);
+      ASCIIClasses classes;
+      ClassifyASCII(block, classes);
+      unsigned bit = 1 << position;
+      BOOST_REQUIRE_EQUAL(bit * (byte >= 0x80), classes.non_ascii);
+      uint8_t flags = byte < 0x80 ? ICUFlags(byte) : 0;
+      BOOST_REQUIRE_EQUAL(bit * ((flags & kAlpha) != 0), classes.alpha);
+      BOOST_REQUIRE_EQUAL(bit * ((flags & kDigit) != 0), classes.digit);
+      BOOST_REQUIRE_EQUAL(bit * ((flags & kPunct) != 0), classes.punct);
+      BOOST_REQUIRE_EQUAL(bit * ((flags & kSpace) != 0), classes.space);
+    }
+  }
+}
+
+} // namespace
+} // namespace utf8
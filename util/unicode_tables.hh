@@ -0,0 +1,1206 @@
+/* Generated by util/unicode_tables_main.cc from ICU 72.1.  Do not edit.
+ * Only util/unicode_properties.cc includes this.
+ */
+
+#include <stdint.h>
+
+namespace utf8 {
+namespace tables {
+
+extern const char kUnicodeVersion[] = "15.0";
+
+extern const uint8_t kStage1[1088] = {
+  0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xa, 0xb, 0xc, 0xd, 0xd, 0xd,
+  0xd, 0xd, 0xd, 0xe, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd,
+  0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xf, 0x10, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12,
+  0x12, 0x12, 0x12, 0x12, 0x12, 0x13, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x15, 0x16,
+  0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x14, 0x21, 0x22, 0x23, 0x14, 0x14,
+  0x14, 0x24, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x25, 0x26, 0x27, 0x27, 0x27, 0x27,
+  0x27, 0x28, 0x29, 0x2a, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x2b, 0x2c, 0x14, 0x14, 0x2d,
+  0x14, 0x14, 0x14, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x14,
+  0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd,
+  0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd,
+  0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0x3a, 0xd, 0xd, 0xd, 0x3b, 0x3c, 0xd,
+  0xd, 0xd, 0xd, 0x3d, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0x3e, 0x14, 0x14, 0x14, 0x3f, 0x14,
+  0xd, 0xd, 0xd, 0xd, 0x40, 0xd, 0xd, 0xd, 0x41, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x42, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+};
+
+extern const uint16_t kStage2[4288] = {
+  0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x8, 0x1, 0x9, 0xa, 0xb, 0xc, 0xb, 0xc,
+  0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb,
+  0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xd, 0xe, 0xf, 0x10, 0x1,
+  0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x13, 0x14, 0x15, 0x16, 0x15, 0x15, 0x15, 0x17, 0x18,
+  0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1a, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+  0x19, 0x19, 0x19, 0x1b, 0x1c, 0x1d, 0x1c, 0x1c, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+  0x26, 0x27, 0x28, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x28, 0x28, 0x28, 0x28, 0x28, 0x2d, 0x2e, 0x2f,
+  0x30, 0x31, 0x31, 0x31, 0x32, 0x28, 0x28, 0x28, 0x33, 0x33, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+  0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f, 0x28, 0x40, 0x41, 0x28, 0x28, 0x42, 0x43, 0x44, 0x28,
+  0x45, 0x45, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52,
+  0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x62,
+  0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72,
+  0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x82,
+  0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f, 0x90, 0x91, 0x92,
+  0x93, 0x94, 0x94, 0x95, 0x96, 0x97, 0x98, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x98, 0x98,
+  0x9f, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa3, 0xa4, 0xa8, 0xa9, 0xaa, 0x98, 0x98,
+  0xab, 0xab, 0xab, 0xac, 0xad, 0xab, 0xab, 0xab, 0xab, 0xae, 0xaf, 0xaf, 0xb0, 0xaf, 0xaf, 0xb1,
+  0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
+  0xb3, 0xb3, 0xb3, 0xb3, 0xb4, 0xb5, 0xb3, 0xb3, 0xb4, 0xb3, 0xb3, 0xb6, 0xb7, 0xb8, 0xb3, 0xb3,
+  0xb3, 0xb7, 0xb3, 0xb3, 0xb3, 0xb9, 0xba, 0xbb, 0xb3, 0xbc, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbe,
+  0xbf, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc1, 0xc0, 0xc2, 0xc3, 0xc4, 0xc4, 0xc4, 0xc4, 0xc5, 0xc6,
+  0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf, 0xcf, 0xcf, 0xd0, 0xd1, 0xd2, 0xd3, 0xd4,
+  0xd5, 0xd6, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd8, 0xd7, 0xd7, 0xd9, 0xc0, 0xc0, 0xc0, 0xc0, 0xda,
+  0xdb, 0xdc, 0xdd, 0xde, 0xdf, 0xe0, 0xe1, 0xe2, 0xe3, 0xe3, 0xe4, 0xe3, 0xe5, 0xe6, 0xe7, 0xe7,
+  0xe8, 0xe9, 0xea, 0xea, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xee, 0xef, 0xf0, 0xf1, 0x98, 0x98, 0x98,
+  0xf2, 0xf2, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf8, 0xf9, 0xfa, 0xfb, 0xfb, 0xfc, 0xfd,
+  0xfe, 0xfe, 0xfe, 0xff, 0x100, 0x101, 0x102, 0x103, 0x104, 0xaf, 0xaf, 0x105, 0x106, 0x107, 0x108, 0x109,
+  0xb, 0xb, 0x10a, 0xb, 0xb, 0x10b, 0x10c, 0x10d, 0xb, 0xb, 0xb, 0x10e, 0x11, 0x11, 0x10f, 0x110,
+  0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb,
+  0x15, 0x111, 0x15, 0x15, 0x111, 0x112, 0x15, 0x113, 0x15, 0x15, 0x15, 0x114, 0x115, 0x116, 0x117, 0x118,
+  0x119, 0x11a, 0x11b, 0x11a, 0x11c, 0x11d, 0x11e, 0x11f, 0x120, 0x121, 0x1, 0x1, 0x122, 0x11, 0x11, 0x123,
+  0x124, 0x125, 0x126, 0x127, 0x128, 0x129, 0x12a, 0x12a, 0x12b, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+  0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+  0x12c, 0x1, 0x12d, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+  0x1, 0x1, 0x12e, 0x98, 0x12f, 0x98, 0x129, 0x129, 0x129, 0x130, 0x1, 0x131, 0x132, 0x132, 0x133, 0x129,
+  0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+  0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+  0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x134, 0x135, 0x129, 0x136, 0x1, 0x1, 0x137, 0x1, 0x138, 0x1,
+  0x139, 0x139, 0x139, 0x139, 0x139, 0x139, 0x139, 0x139, 0x139, 0x139, 0x139, 0x139, 0x139, 0x139, 0x139, 0x139,
+  0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x13a, 0x13b, 0x1, 0x1, 0x1, 0x12c, 0x1, 0x13c,
+  0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+  0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x13d, 0x1, 0x13e, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+  0x13f, 0x13f, 0x13f, 0x13f, 0x13f, 0x13f, 0xb, 0xb, 0x140, 0x140, 0x140, 0x140, 0x140, 0x140, 0x141, 0x142,
+  0xaf, 0xaf, 0xb0, 0x143, 0x143, 0x143, 0x144, 0x145, 0xb3, 0x146, 0x147, 0x147, 0x147, 0x147, 0x19, 0x19,
+  0x11a, 0x11a, 0x148, 0x11a, 0x11a, 0x149, 0x98, 0x98, 0x14a, 0x14b, 0x14a, 0x14a, 0x14a, 0x14a, 0x14a, 0x14c,
+  0x14a, 0x14a, 0x14a, 0x14a, 0x14a, 0x14a, 0x14a, 0x14a, 0x14a, 0x14a, 0x14a, 0x14a, 0x14a, 0x14d, 0x98, 0x14e,
+  0x14f, 0x150, 0x151, 0x152, 0x153, 0x154, 0x154, 0x154, 0x154, 0x155, 0x156, 0x157, 0x157, 0x157, 0x157, 0x158,
+  0x159, 0x15a, 0x15a, 0x15b, 0xb2, 0xb2, 0xb2, 0xb2, 0x15c, 0x15d, 0x15a, 0x15a, 0x1, 0x1, 0x15e, 0x157,
+  0x15f, 0x160, 0x161, 0x1, 0x162, 0x163, 0x15f, 0x164, 0x161, 0x1, 0x1, 0x163, 0x1, 0x165, 0x165, 0x166,
+  0x165, 0x165, 0x165, 0x165, 0x165, 0x167, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x1, 0x1, 0x1, 0x1,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169,
+  0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169,
+  0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169,
+  0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169,
+  0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x169, 0x16a, 0x16b, 0x16b, 0x16b, 0x16c, 0x16d, 0x16d, 0x16e,
+  0x16f, 0x16f, 0x16f, 0x16f, 0x16f, 0x16f, 0x16f, 0x16f, 0x16f, 0x16f, 0x16f, 0x16f, 0x16f, 0x16f, 0x16f, 0x16f,
+  0x170, 0x16f, 0x171, 0x98, 0x19, 0x19, 0x172, 0x173, 0x19, 0x19, 0x174, 0x174, 0x174, 0x174, 0x175, 0x176,
+  0x1, 0x177, 0x178, 0xb, 0xb, 0xb, 0xb, 0xb, 0x179, 0xb, 0xb, 0xb, 0x17a, 0x17b, 0x98, 0x17c,
+  0x17d, 0x17e, 0x17f, 0x180, 0x181, 0x181, 0x181, 0x182, 0x183, 0x183, 0x183, 0x183, 0x184, 0x185, 0x186, 0x187,
+  0x188, 0x189, 0x18a, 0x18b, 0x18b, 0x18c, 0xb2, 0x18d, 0x18e, 0x18e, 0x18e, 0x18f, 0x190, 0x191, 0xab, 0x192,
+  0x193, 0x193, 0x193, 0x194, 0x195, 0x196, 0xab, 0x197, 0x198, 0x198, 0x198, 0x199, 0x19a, 0x19b, 0x19c, 0x19d,
+  0x19e, 0x19f, 0x147, 0xb, 0xb, 0x1a0, 0x1a1, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0x19c, 0x19c, 0x1a2, 0x1a3,
+  0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
+  0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
+  0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
+  0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
+  0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
+  0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
+  0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
+  0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0x1a4, 0xb2, 0x1a5, 0xb2, 0xb2, 0x1a6,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x1a7, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x1a8, 0x98, 0x98,
+  0x1a9, 0x1aa, 0x1ab, 0x1ac, 0x1ad, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x1ae, 0x1af, 0x1b0, 0x28, 0x28,
+  0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+  0x28, 0x28, 0x28, 0x1b1, 0x1b2, 0x28, 0x28, 0x28, 0x28, 0x1b3, 0x28, 0x28, 0x1b4, 0x98, 0x98, 0x1b5,
+  0x11, 0x1b6, 0x1b7, 0x11a, 0x11a, 0x1b8, 0x1b9, 0x1ba, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x1bb,
+  0x1bc, 0x3, 0x4, 0x5, 0x6, 0x1bd, 0x1be, 0x1bf, 0x157, 0x1c0, 0xb2, 0x15c, 0x1c1, 0x1c2, 0x1c3, 0x1c4,
+  0x1c5, 0x1c6, 0x1c7, 0x1c8, 0x1c9, 0x1c9, 0x98, 0x98, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1ca,
+  0x1cb, 0x129, 0x129, 0x1cc, 0x1cd, 0x1cd, 0x1cd, 0x1ce, 0x1cf, 0x1d0, 0x1d1, 0x98, 0x98, 0x1, 0x1, 0x1d2,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x1d3, 0x1d4, 0x1d5, 0x1d5, 0x1d5, 0x1d6, 0x1d7, 0x1d8,
+  0x1d9, 0x1d9, 0x1da, 0x1db, 0x1dc, 0x1dd, 0x1dd, 0x1de, 0x1df, 0x1e0, 0x1e1, 0x1e1, 0x1e2, 0x1e3, 0x98, 0x98,
+  0x1e4, 0x1e4, 0x1e4, 0x1e4, 0x1e4, 0x1e5, 0x1e5, 0x1e5, 0x1e6, 0x1e7, 0x1e8, 0x1e9, 0x1e9, 0x1ea, 0x1e9, 0x1eb,
+  0x1ec, 0x1ec, 0x1ed, 0x1ee, 0x1ee, 0x1ee, 0x1ef, 0x1f0, 0x1f0, 0x1f1, 0x1f2, 0x1f3, 0x98, 0x98, 0x98, 0x98,
+  0x1f4, 0x1f4, 0x1f4, 0x1f4, 0x1f4, 0x1f4, 0x1f4, 0x1f4, 0x1f4, 0x1f4, 0x1f4, 0x1f4, 0x1f4, 0x1f4, 0x1f4, 0x1f4,
+  0x1f4, 0x1f4, 0x1f4, 0x1f5, 0x1f4, 0x1f6, 0x1f7, 0x98, 0x1f8, 0xb, 0xb, 0x1f9, 0x98, 0x98, 0x98, 0x98,
+  0x1fa, 0x1fb, 0x1fb, 0x1fc, 0x1fd, 0x1fe, 0x1ff, 0x200, 0x201, 0x202, 0x203, 0x98, 0x98, 0x98, 0x204, 0x205,
+  0x206, 0x207, 0x208, 0x209, 0x98, 0x98, 0x98, 0x98, 0x20a, 0x20a, 0x20b, 0x20c, 0x20d, 0x20e, 0x20d, 0x20d,
+  0x20f, 0x210, 0x211, 0x212, 0x213, 0x214, 0x215, 0x216, 0x217, 0x218, 0x98, 0x98, 0x219, 0x21a, 0x21b, 0x21c,
+  0x21d, 0x21d, 0x21d, 0x21e, 0x21f, 0x220, 0x221, 0x222, 0x223, 0x224, 0x225, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x226, 0x226, 0x226, 0x226, 0x227, 0x98, 0x98, 0x98, 0x228, 0x228, 0x228, 0x229, 0x228, 0x228, 0x228, 0x22a,
+  0x22b, 0x22b, 0x22c, 0x22d, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x22e, 0x22f, 0x230, 0x230, 0x231, 0x232, 0x98, 0x98, 0x98, 0x233,
+  0x234, 0x235, 0x236, 0x237, 0x238, 0x239, 0x98, 0x23a, 0x23b, 0x98, 0x98, 0x23c, 0x23d, 0x98, 0x23e, 0x23f,
+  0x240, 0x240, 0x240, 0x240, 0x241, 0x242, 0x243, 0x244, 0x245, 0x245, 0x245, 0x246, 0x247, 0x248, 0x249, 0x24a,
+  0x24b, 0x24b, 0x24b, 0x24c, 0x24d, 0x24e, 0x24e, 0x24f, 0x250, 0x250, 0x250, 0x250, 0x251, 0x252, 0x253, 0x254,
+  0x255, 0x256, 0x255, 0x257, 0x258, 0x98, 0x98, 0x98, 0x259, 0x25a, 0x25b, 0x25c, 0x25c, 0x25c, 0x25d, 0x25e,
+  0x25f, 0x260, 0x261, 0x262, 0x263, 0x264, 0x265, 0x266, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x267, 0x267, 0x267, 0x267, 0x268, 0x269, 0x26a, 0x98, 0x26b, 0x26b, 0x26b, 0x26b, 0x26c, 0x26d, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x26e, 0x26e, 0x26e, 0x26f, 0x270, 0x271, 0x98, 0x98,
+  0x272, 0x272, 0x272, 0x273, 0x274, 0x275, 0x276, 0x98, 0x277, 0x277, 0x277, 0x278, 0x279, 0x98, 0x98, 0x98,
+  0x27a, 0x27b, 0x27c, 0x27d, 0x27e, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x27f, 0x27f, 0x27f, 0x280, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x281, 0x281, 0x281, 0x281, 0x282, 0x283,
+  0x284, 0x285, 0x286, 0x287, 0x288, 0x289, 0x98, 0x98, 0x98, 0x98, 0x28a, 0x28b, 0x28b, 0x28a, 0x28c, 0x98,
+  0x28d, 0x28d, 0x28d, 0x28e, 0x28f, 0x290, 0x290, 0x290, 0x290, 0x291, 0x292, 0xc0, 0x293, 0x293, 0x293, 0x294,
+  0x295, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x296, 0x297, 0x297, 0x298, 0x299, 0x29a, 0x29b, 0x29c, 0x29d, 0x29e, 0x29f, 0x2a0, 0x98, 0x98, 0x98, 0x98,
+  0x2a1, 0x2a2, 0x2a2, 0x2a3, 0x2a4, 0x2a5, 0x2a6, 0x2a7, 0x2a8, 0x2a9, 0x2aa, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x2ab, 0x2ac,
+  0x2ad, 0x2ae, 0x2ad, 0x2af, 0x2b0, 0x2b1, 0x98, 0x98, 0x98, 0x98, 0x98, 0x2b2, 0x2b3, 0x2b4, 0x2b5, 0x2b6,
+  0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7,
+  0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7,
+  0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7,
+  0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b8, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x2b9, 0x2b9, 0x2b9, 0x2b9, 0x2b9, 0x2b9, 0x2ba, 0x2bb, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2b7,
+  0x2b7, 0x2b7, 0x2b7, 0x2b7, 0x2bc, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x2bd, 0x2bd, 0x2bd, 0x2bd, 0x2bd, 0x2bd, 0x2be,
+  0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf,
+  0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf,
+  0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf,
+  0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf, 0x2bf,
+  0x2bf, 0x2bf, 0x2bf, 0x2c0, 0x2c1, 0x2c2, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x2c3, 0x2c3, 0x2c3, 0x2c3, 0x2c3, 0x2c3, 0x2c3, 0x2c3, 0x2c3, 0x2c3, 0x2c3, 0x2c3, 0x2c3, 0x2c3, 0x2c3, 0x2c3,
+  0x2c3, 0x2c3, 0x2c3, 0x2c3, 0x2c3, 0x2c3, 0x2c3, 0x2c3, 0x2c3, 0x2c3, 0x2c3, 0x2c3, 0x2c3, 0x2c3, 0x2c3, 0x2c3,
+  0x2c3, 0x2c3, 0x2c3, 0x2c3, 0x2c4, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174,
+  0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174,
+  0x174, 0x174, 0x174, 0x2c5, 0x2c6, 0x2c7, 0x2c8, 0x2c9, 0x2c9, 0x2c9, 0x2c9, 0x2ca, 0x2cb, 0x2cc, 0x2cd, 0x2ce,
+  0x2cf, 0x2cf, 0x2cf, 0x2d0, 0x2d1, 0x2d2, 0x2d3, 0x2d4, 0x2cf, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x2d5, 0x2d5, 0x2d5, 0x2d5, 0x2d6, 0x2d7, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x2d8, 0x2d8, 0x2d8, 0x2d8, 0x2d9, 0x2d8, 0x2d8, 0x2d8, 0x2da, 0x2d8, 0x98, 0x98, 0x98, 0x98, 0x2db, 0x2dc,
+  0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd,
+  0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd,
+  0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd,
+  0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd,
+  0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd,
+  0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd,
+  0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd,
+  0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2de,
+  0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd,
+  0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd,
+  0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd, 0x2dd,
+  0x2df, 0x2df, 0x2df, 0x2df, 0x2df, 0x2df, 0x2df, 0x2df, 0x2df, 0x2df, 0x2df, 0x2df, 0x2df, 0x2df, 0x2df, 0x2df,
+  0x2df, 0x2df, 0x2df, 0x2df, 0x2df, 0x2df, 0x2df, 0x2df, 0x2df, 0x2df, 0x2df, 0x2df, 0x2df, 0x2e0, 0x98, 0x98,
+  0x2e1, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x2e2,
+  0x2e3, 0x154, 0x154, 0x154, 0x154, 0x154, 0x154, 0x154, 0x154, 0x154, 0x154, 0x154, 0x154, 0x154, 0x154, 0x154,
+  0x154, 0x154, 0x2e4, 0x2e5, 0x98, 0x2e6, 0x2e7, 0x2e8, 0x2e8, 0x2e8, 0x2e8, 0x2e8, 0x2e8, 0x2e8, 0x2e8, 0x2e8,
+  0x2e8, 0x2e8, 0x2e8, 0x2e8, 0x2e8, 0x2e8, 0x2e8, 0x2e8, 0x2e8, 0x2e8, 0x2e8, 0x2e8, 0x2e8, 0x2e8, 0x2e8, 0x2e9,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x2ea, 0x2ea, 0x2ea, 0x2ea, 0x2ea, 0x2ea, 0x2eb, 0x2ec, 0x2ed, 0x2ee, 0x15e, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x11, 0x11, 0x2ef, 0x11, 0x2f0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x15e, 0x98, 0x98, 0x98,
+  0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x2f1,
+  0x1, 0x1, 0x2f2, 0x1, 0x1, 0x1, 0x2f3, 0x2f4, 0x2f5, 0x1, 0x2f6, 0x1, 0x1, 0x1, 0x12f, 0x98,
+  0x2f7, 0x2f7, 0x2f7, 0x2f7, 0x2f8, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x129, 0x2f9, 0x129, 0x2f9,
+  0x1, 0x1, 0x1, 0x1, 0x1, 0x12e, 0x129, 0x2fa, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x132, 0x132, 0x132, 0x132, 0x132, 0x2fb, 0x132, 0x132, 0x132, 0x2fc, 0x2fd, 0x2fe, 0x2ff, 0x132, 0x132, 0x132,
+  0x300, 0x301, 0x132, 0x302, 0x303, 0x304, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132,
+  0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x305, 0x132, 0x306, 0x307, 0x132, 0x307,
+  0x132, 0x308, 0x132, 0x308, 0x309, 0x132, 0x309, 0x132, 0x30a, 0x132, 0x30a, 0x132, 0x30b, 0x30c, 0x30c, 0x30c,
+  0x30d, 0x30d, 0x30d, 0x30d, 0x30d, 0x30d, 0x30d, 0x30d, 0x30d, 0x30d, 0x30d, 0x30d, 0x30d, 0x30d, 0x30d, 0x30d,
+  0x30d, 0x30d, 0x30d, 0x30d, 0x30d, 0x30d, 0x30d, 0x30d, 0x30d, 0x30d, 0x30d, 0x30d, 0x30d, 0x30d, 0x30d, 0x30d,
+  0x30d, 0x30d, 0x30d, 0x30d, 0x30d, 0x30d, 0x30d, 0x30d, 0x30e, 0x30f, 0x310, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0xb, 0x311, 0x312, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x313, 0x314, 0x315, 0x19, 0x19, 0x19, 0x316, 0x98, 0x317, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x318, 0x318, 0x319, 0x31a, 0x31b, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x31c, 0x31d, 0x98, 0x31e, 0x31e, 0x31f, 0x320,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x321, 0x322, 0x323,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x324, 0x325,
+  0x326, 0x326, 0x326, 0x326, 0x326, 0x326, 0x326, 0x326, 0x326, 0x326, 0x326, 0x326, 0x327, 0x328, 0x98, 0x98,
+  0x329, 0x329, 0x329, 0x329, 0x32a, 0x32b, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x32c, 0x129, 0x129, 0x32d, 0x32e, 0x98, 0x98, 0x98, 0x98,
+  0x32c, 0x129, 0x32f, 0x330, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x331, 0x28, 0x332, 0x333, 0x334, 0x335, 0x336, 0x337, 0x338, 0x339, 0x33a, 0x339, 0x98, 0x98, 0x98, 0x33b,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x1, 0x1, 0x14e, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x15e, 0x33c, 0x33d, 0x33d, 0x33d, 0x1, 0x2f1,
+  0x33e, 0x1, 0x1, 0x132, 0x33f, 0x132, 0x33f, 0x132, 0x33f, 0x1, 0x340, 0x98, 0x98, 0x98, 0x341, 0x1,
+  0x342, 0x1, 0x1, 0x14e, 0x343, 0x344, 0x2f1, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+  0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+  0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+  0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x345, 0x1d0, 0x1d0,
+  0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x346, 0x1, 0x1, 0x1, 0x1, 0x1, 0x347, 0x14e, 0x122,
+  0x14e, 0x1, 0x1, 0x1, 0x348, 0x347, 0x1, 0x1, 0x348, 0x1, 0x340, 0x344, 0x98, 0x98, 0x98, 0x98,
+  0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+  0x1, 0x1, 0x1, 0x1, 0x1, 0x15e, 0x340, 0x1d0, 0x343, 0x1, 0x1, 0x349, 0x34a, 0x14e, 0x343, 0x343,
+  0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x34b, 0x1, 0x1, 0x12f, 0x98, 0x98, 0x34c,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x98, 0x98,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x1a8, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x1a7, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x2dc, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x34d, 0x98,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x1a7, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x34e, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x34f, 0x98, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+};
+
+extern const uint16_t kStage3[13568] = {
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x1000, 0x800, 0x800, 0x800, 0x0, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x0, 0x800, 0x800, 0x800, 0x800,
+  0x600, 0x600, 0x600, 0x600, 0x600, 0x600, 0x600, 0x600, 0x600, 0x600, 0x800, 0x800, 0x0, 0x0, 0x0, 0x800,
+  0x800, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119,
+  0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x800, 0x800, 0x800, 0x0, 0x800,
+  0x0, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119,
+  0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x800, 0x0, 0x800, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x1000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x1000, 0x800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x800, 0x0, 0x0, 0x119, 0x800, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x400, 0x400, 0x0, 0x100, 0x800, 0x800, 0x0, 0x400, 0x119, 0x800, 0x400, 0x400, 0x400, 0x800,
+  0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119,
+  0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x0, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119,
+  0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+  0x100, 0x100, 0x0, 0x0, 0x0, 0x0, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+  0x100, 0x100, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x119, 0x119, 0x119, 0x119, 0x119, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x5, 0x100, 0x0, 0x100, 0x0,
+  0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+  0x1, 0x1, 0x1, 0x1, 0x1, 0x101, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+  0x10e, 0x10e, 0x10e, 0x10e, 0x100, 0xe, 0x10e, 0x10e, 0x67, 0x67, 0x10e, 0x10e, 0x10e, 0x10e, 0x800, 0x10e,
+  0x67, 0x67, 0x67, 0x67, 0xe, 0x0, 0x10e, 0x800, 0x10e, 0x10e, 0x10e, 0x67, 0x10e, 0x67, 0x10e, 0x10e,
+  0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e,
+  0x10e, 0x10e, 0x67, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e,
+  0x10e, 0x10e, 0x107, 0x107, 0x107, 0x107, 0x107, 0x107, 0x107, 0x107, 0x107, 0x107, 0x107, 0x107, 0x107, 0x107,
+  0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0xe, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e,
+  0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108,
+  0x108, 0x108, 0x8, 0x8, 0x8, 0x1, 0x1, 0x8, 0x8, 0x8, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108,
+  0x67, 0x103, 0x103, 0x103, 0x103, 0x103, 0x103, 0x103, 0x103, 0x103, 0x103, 0x103, 0x103, 0x103, 0x103, 0x103,
+  0x103, 0x103, 0x103, 0x103, 0x103, 0x103, 0x103, 0x103, 0x103, 0x103, 0x103, 0x103, 0x103, 0x103, 0x103, 0x103,
+  0x103, 0x103, 0x103, 0x103, 0x103, 0x103, 0x103, 0x67, 0x67, 0x103, 0x803, 0x803, 0x803, 0x803, 0x803, 0x803,
+  0x103, 0x103, 0x103, 0x103, 0x103, 0x103, 0x103, 0x103, 0x103, 0x803, 0x803, 0x67, 0x67, 0x3, 0x3, 0x3,
+  0x67, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+  0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+  0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x813, 0x113,
+  0x813, 0x113, 0x113, 0x813, 0x113, 0x113, 0x813, 0x113, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113,
+  0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x67, 0x67, 0x67, 0x67, 0x113,
+  0x113, 0x113, 0x113, 0x813, 0x813, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x2, 0x2, 0x2, 0x2, 0x2, 0x0, 0x2, 0x2, 0x2, 0x802, 0x802, 0x2, 0x800, 0x802, 0x2, 0x2,
+  0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x800, 0x2, 0x802, 0x802, 0x800,
+  0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102,
+  0x100, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x101, 0x101, 0x101, 0x101, 0x101,
+  0x101, 0x101, 0x101, 0x101, 0x101, 0x101, 0x102, 0x102, 0x2, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102,
+  0x602, 0x602, 0x602, 0x602, 0x602, 0x602, 0x602, 0x602, 0x602, 0x602, 0x802, 0x802, 0x802, 0x802, 0x102, 0x102,
+  0x101, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102,
+  0x102, 0x102, 0x102, 0x102, 0x802, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x0, 0x2, 0x2,
+  0x2, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x2, 0x2, 0x2, 0x2, 0x102, 0x102, 0x102,
+  0x602, 0x602, 0x602, 0x602, 0x602, 0x602, 0x602, 0x602, 0x602, 0x602, 0x102, 0x102, 0x102, 0x2, 0x2, 0x102,
+  0x822, 0x822, 0x822, 0x822, 0x822, 0x822, 0x822, 0x822, 0x822, 0x822, 0x822, 0x822, 0x822, 0x822, 0x67, 0x22,
+  0x122, 0x122, 0x122, 0x122, 0x122, 0x122, 0x122, 0x122, 0x122, 0x122, 0x122, 0x122, 0x122, 0x122, 0x122, 0x122,
+  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x67, 0x67, 0x122, 0x122, 0x122,
+  0x125, 0x125, 0x125, 0x125, 0x125, 0x125, 0x125, 0x125, 0x125, 0x125, 0x125, 0x125, 0x125, 0x125, 0x125, 0x125,
+  0x125, 0x125, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x657, 0x657, 0x657, 0x657, 0x657, 0x657, 0x657, 0x657, 0x657, 0x657, 0x157, 0x157, 0x157, 0x157, 0x157, 0x157,
+  0x157, 0x157, 0x157, 0x157, 0x157, 0x157, 0x157, 0x157, 0x157, 0x157, 0x157, 0x157, 0x157, 0x157, 0x157, 0x157,
+  0x157, 0x157, 0x157, 0x157, 0x157, 0x157, 0x157, 0x157, 0x157, 0x157, 0x157, 0x57, 0x57, 0x57, 0x57, 0x57,
+  0x57, 0x57, 0x57, 0x57, 0x157, 0x157, 0x57, 0x857, 0x857, 0x857, 0x157, 0x67, 0x67, 0x57, 0x57, 0x57,
+  0x17e, 0x17e, 0x17e, 0x17e, 0x17e, 0x17e, 0x17e, 0x17e, 0x17e, 0x17e, 0x17e, 0x17e, 0x17e, 0x17e, 0x17e, 0x17e,
+  0x17e, 0x17e, 0x17e, 0x17e, 0x17e, 0x17e, 0x17e, 0x17e, 0x7e, 0x7e, 0x17e, 0x17e, 0x17e, 0x17e, 0x17e, 0x17e,
+  0x17e, 0x17e, 0x17e, 0x17e, 0x17e, 0x17e, 0x17e, 0x17e, 0x17e, 0x17e, 0x17e, 0x17e, 0x17e, 0x7e, 0x67, 0x67,
+  0x87e, 0x87e, 0x87e, 0x87e, 0x87e, 0x87e, 0x87e, 0x87e, 0x87e, 0x87e, 0x87e, 0x87e, 0x87e, 0x87e, 0x87e, 0x67,
+  0x154, 0x154, 0x154, 0x154, 0x154, 0x154, 0x154, 0x154, 0x154, 0x154, 0x154, 0x154, 0x154, 0x154, 0x154, 0x154,
+  0x154, 0x154, 0x154, 0x154, 0x154, 0x154, 0x154, 0x154, 0x154, 0x54, 0x54, 0x54, 0x67, 0x67, 0x854, 0x67,
+  0x122, 0x122, 0x122, 0x122, 0x122, 0x122, 0x122, 0x122, 0x122, 0x122, 0x122, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x2, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x67,
+  0x2, 0x2, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+  0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+  0x2, 0x2, 0x2, 0x2, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102,
+  0x2, 0x2, 0x0, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+  0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a,
+  0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0xa, 0x10a, 0x10a, 0x10a,
+  0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0xa, 0x10a, 0x10a,
+  0x10a, 0x1, 0x1, 0x1, 0x1, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a,
+  0x10a, 0x10a, 0x10a, 0x10a, 0x800, 0x800, 0x60a, 0x60a, 0x60a, 0x60a, 0x60a, 0x60a, 0x60a, 0x60a, 0x60a, 0x60a,
+  0x80a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a,
+  0x104, 0x104, 0x104, 0x104, 0x67, 0x104, 0x104, 0x104, 0x104, 0x104, 0x104, 0x104, 0x104, 0x67, 0x67, 0x104,
+  0x104, 0x67, 0x67, 0x104, 0x104, 0x104, 0x104, 0x104, 0x104, 0x104, 0x104, 0x104, 0x104, 0x104, 0x104, 0x104,
+  0x104, 0x104, 0x104, 0x104, 0x104, 0x104, 0x104, 0x104, 0x104, 0x67, 0x104, 0x104, 0x104, 0x104, 0x104, 0x104,
+  0x104, 0x67, 0x104, 0x67, 0x67, 0x67, 0x104, 0x104, 0x104, 0x104, 0x67, 0x67, 0x4, 0x104, 0x104, 0x104,
+  0x104, 0x104, 0x104, 0x104, 0x104, 0x67, 0x67, 0x104, 0x104, 0x67, 0x67, 0x104, 0x104, 0x4, 0x104, 0x67,
+  0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x104, 0x67, 0x67, 0x67, 0x67, 0x104, 0x104, 0x67, 0x104,
+  0x104, 0x104, 0x104, 0x104, 0x67, 0x67, 0x604, 0x604, 0x604, 0x604, 0x604, 0x604, 0x604, 0x604, 0x604, 0x604,
+  0x104, 0x104, 0x4, 0x4, 0x404, 0x404, 0x404, 0x404, 0x404, 0x404, 0x4, 0x4, 0x104, 0x804, 0x4, 0x67,
+  0x67, 0x110, 0x110, 0x110, 0x67, 0x110, 0x110, 0x110, 0x110, 0x110, 0x110, 0x67, 0x67, 0x67, 0x67, 0x110,
+  0x110, 0x67, 0x67, 0x110, 0x110, 0x110, 0x110, 0x110, 0x110, 0x110, 0x110, 0x110, 0x110, 0x110, 0x110, 0x110,
+  0x110, 0x110, 0x110, 0x110, 0x110, 0x110, 0x110, 0x110, 0x110, 0x67, 0x110, 0x110, 0x110, 0x110, 0x110, 0x110,
+  0x110, 0x67, 0x110, 0x110, 0x67, 0x110, 0x110, 0x67, 0x110, 0x110, 0x67, 0x67, 0x10, 0x67, 0x110, 0x110,
+  0x110, 0x110, 0x110, 0x67, 0x67, 0x67, 0x67, 0x110, 0x110, 0x67, 0x67, 0x110, 0x110, 0x10, 0x67, 0x67,
+  0x67, 0x110, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x110, 0x110, 0x110, 0x110, 0x67, 0x110, 0x67,
+  0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x610, 0x610, 0x610, 0x610, 0x610, 0x610, 0x610, 0x610, 0x610, 0x610,
+  0x110, 0x110, 0x110, 0x110, 0x110, 0x110, 0x810, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x67, 0x10f, 0x10f, 0x10f, 0x67, 0x10f, 0x10f, 0x10f, 0x10f, 0x10f, 0x10f, 0x10f, 0x10f, 0x10f, 0x67, 0x10f,
+  0x10f, 0x10f, 0x67, 0x10f, 0x10f, 0x10f, 0x10f, 0x10f, 0x10f, 0x10f, 0x10f, 0x10f, 0x10f, 0x10f, 0x10f, 0x10f,
+  0x10f, 0x10f, 0x10f, 0x10f, 0x10f, 0x10f, 0x10f, 0x10f, 0x10f, 0x67, 0x10f, 0x10f, 0x10f, 0x10f, 0x10f, 0x10f,
+  0x10f, 0x67, 0x10f, 0x10f, 0x67, 0x10f, 0x10f, 0x10f, 0x10f, 0x10f, 0x67, 0x67, 0xf, 0x10f, 0x10f, 0x10f,
+  0x10f, 0x10f, 0x10f, 0x10f, 0x10f, 0x10f, 0x67, 0x10f, 0x10f, 0x10f, 0x67, 0x10f, 0x10f, 0xf, 0x67, 0x67,
+  0x10f, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x10f, 0x10f, 0x10f, 0x10f, 0x67, 0x67, 0x60f, 0x60f, 0x60f, 0x60f, 0x60f, 0x60f, 0x60f, 0x60f, 0x60f, 0x60f,
+  0x80f, 0xf, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x10f, 0x10f, 0x10f, 0x10f, 0xf, 0xf, 0xf,
+  0x67, 0x11f, 0x11f, 0x11f, 0x67, 0x11f, 0x11f, 0x11f, 0x11f, 0x11f, 0x11f, 0x11f, 0x11f, 0x67, 0x67, 0x11f,
+  0x11f, 0x67, 0x67, 0x11f, 0x11f, 0x11f, 0x11f, 0x11f, 0x11f, 0x11f, 0x11f, 0x11f, 0x11f, 0x11f, 0x11f, 0x11f,
+  0x11f, 0x11f, 0x11f, 0x11f, 0x11f, 0x11f, 0x11f, 0x11f, 0x11f, 0x67, 0x11f, 0x11f, 0x11f, 0x11f, 0x11f, 0x11f,
+  0x11f, 0x67, 0x11f, 0x11f, 0x67, 0x11f, 0x11f, 0x11f, 0x11f, 0x11f, 0x67, 0x67, 0x1f, 0x11f, 0x11f, 0x11f,
+  0x11f, 0x11f, 0x11f, 0x11f, 0x11f, 0x67, 0x67, 0x11f, 0x11f, 0x67, 0x67, 0x11f, 0x11f, 0x1f, 0x67, 0x67,
+  0x67, 0x67, 0x67, 0x67, 0x67, 0x1f, 0x11f, 0x11f, 0x67, 0x67, 0x67, 0x67, 0x11f, 0x11f, 0x67, 0x11f,
+  0x11f, 0x11f, 0x11f, 0x11f, 0x67, 0x67, 0x61f, 0x61f, 0x61f, 0x61f, 0x61f, 0x61f, 0x61f, 0x61f, 0x61f, 0x61f,
+  0x1f, 0x11f, 0x41f, 0x41f, 0x41f, 0x41f, 0x41f, 0x41f, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x67, 0x67, 0x123, 0x123, 0x67, 0x123, 0x123, 0x123, 0x123, 0x123, 0x123, 0x67, 0x67, 0x67, 0x123, 0x123,
+  0x123, 0x67, 0x123, 0x123, 0x123, 0x123, 0x67, 0x67, 0x67, 0x123, 0x123, 0x67, 0x123, 0x67, 0x123, 0x123,
+  0x67, 0x67, 0x67, 0x123, 0x123, 0x67, 0x67, 0x67, 0x123, 0x123, 0x123, 0x67, 0x67, 0x67, 0x123, 0x123,
+  0x123, 0x123, 0x123, 0x123, 0x123, 0x123, 0x123, 0x123, 0x123, 0x123, 0x67, 0x67, 0x67, 0x67, 0x123, 0x123,
+  0x123, 0x123, 0x123, 0x67, 0x67, 0x67, 0x123, 0x123, 0x123, 0x67, 0x123, 0x123, 0x123, 0x23, 0x67, 0x67,
+  0x123, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x123, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x623, 0x623, 0x623, 0x623, 0x623, 0x623, 0x623, 0x623, 0x623, 0x623,
+  0x423, 0x423, 0x423, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x124, 0x124, 0x124, 0x124, 0x124, 0x124, 0x124, 0x124, 0x124, 0x124, 0x124, 0x124, 0x124, 0x67, 0x124, 0x124,
+  0x124, 0x67, 0x124, 0x124, 0x124, 0x124, 0x124, 0x124, 0x124, 0x124, 0x124, 0x124, 0x124, 0x124, 0x124, 0x124,
+  0x124, 0x124, 0x124, 0x124, 0x124, 0x124, 0x124, 0x124, 0x124, 0x67, 0x124, 0x124, 0x124, 0x124, 0x124, 0x124,
+  0x124, 0x124, 0x124, 0x124, 0x124, 0x124, 0x124, 0x124, 0x124, 0x124, 0x67, 0x67, 0x24, 0x124, 0x124, 0x124,
+  0x124, 0x124, 0x124, 0x124, 0x124, 0x67, 0x124, 0x124, 0x124, 0x67, 0x124, 0x124, 0x124, 0x24, 0x67, 0x67,
+  0x67, 0x67, 0x67, 0x67, 0x67, 0x124, 0x124, 0x67, 0x124, 0x124, 0x124, 0x67, 0x67, 0x124, 0x67, 0x67,
+  0x124, 0x124, 0x124, 0x124, 0x67, 0x67, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+  0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x824, 0x424, 0x424, 0x424, 0x424, 0x424, 0x424, 0x424, 0x24,
+  0x115, 0x115, 0x115, 0x115, 0x815, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x67, 0x115, 0x115,
+  0x115, 0x67, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115,
+  0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x67, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115,
+  0x115, 0x115, 0x115, 0x115, 0x67, 0x115, 0x115, 0x115, 0x115, 0x115, 0x67, 0x67, 0x15, 0x115, 0x115, 0x115,
+  0x115, 0x115, 0x115, 0x115, 0x115, 0x67, 0x115, 0x115, 0x115, 0x67, 0x115, 0x115, 0x115, 0x15, 0x67, 0x67,
+  0x67, 0x67, 0x67, 0x67, 0x67, 0x115, 0x115, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x115, 0x115, 0x67,
+  0x115, 0x115, 0x115, 0x115, 0x67, 0x67, 0x615, 0x615, 0x615, 0x615, 0x615, 0x615, 0x615, 0x615, 0x615, 0x615,
+  0x67, 0x115, 0x115, 0x115, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x67, 0x11a, 0x11a,
+  0x11a, 0x67, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a,
+  0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a,
+  0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x1a, 0x1a, 0x11a, 0x11a, 0x11a,
+  0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x67, 0x11a, 0x11a, 0x11a, 0x67, 0x11a, 0x11a, 0x11a, 0x1a, 0x11a, 0x1a,
+  0x67, 0x67, 0x67, 0x67, 0x11a, 0x11a, 0x11a, 0x11a, 0x41a, 0x41a, 0x41a, 0x41a, 0x41a, 0x41a, 0x41a, 0x11a,
+  0x11a, 0x11a, 0x11a, 0x11a, 0x67, 0x67, 0x61a, 0x61a, 0x61a, 0x61a, 0x61a, 0x61a, 0x61a, 0x61a, 0x61a, 0x61a,
+  0x41a, 0x41a, 0x41a, 0x41a, 0x41a, 0x41a, 0x41a, 0x41a, 0x41a, 0x1a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a, 0x11a,
+  0x67, 0x121, 0x121, 0x121, 0x67, 0x121, 0x121, 0x121, 0x121, 0x121, 0x121, 0x121, 0x121, 0x121, 0x121, 0x121,
+  0x121, 0x121, 0x121, 0x121, 0x121, 0x121, 0x121, 0x67, 0x67, 0x67, 0x121, 0x121, 0x121, 0x121, 0x121, 0x121,
+  0x121, 0x121, 0x121, 0x121, 0x121, 0x121, 0x121, 0x121, 0x121, 0x121, 0x121, 0x121, 0x121, 0x121, 0x121, 0x121,
+  0x121, 0x121, 0x67, 0x121, 0x121, 0x121, 0x121, 0x121, 0x121, 0x121, 0x121, 0x121, 0x67, 0x121, 0x67, 0x67,
+  0x121, 0x121, 0x121, 0x121, 0x121, 0x121, 0x121, 0x67, 0x67, 0x67, 0x21, 0x67, 0x67, 0x67, 0x67, 0x121,
+  0x121, 0x121, 0x121, 0x121, 0x121, 0x67, 0x121, 0x67, 0x121, 0x121, 0x121, 0x121, 0x121, 0x121, 0x121, 0x121,
+  0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x621, 0x621, 0x621, 0x621, 0x621, 0x621, 0x621, 0x621, 0x621, 0x621,
+  0x67, 0x67, 0x121, 0x121, 0x821, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x67, 0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x126,
+  0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x126,
+  0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x67, 0x67, 0x67, 0x67, 0x0,
+  0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x126, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x126, 0x26, 0x826,
+  0x626, 0x626, 0x626, 0x626, 0x626, 0x626, 0x626, 0x626, 0x626, 0x626, 0x826, 0x826, 0x67, 0x67, 0x67, 0x67,
+  0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x67, 0x118, 0x118, 0x67, 0x118, 0x67, 0x118, 0x118, 0x118, 0x118, 0x118, 0x67, 0x118, 0x118, 0x118, 0x118,
+  0x118, 0x118, 0x118, 0x118, 0x118, 0x118, 0x118, 0x118, 0x118, 0x118, 0x118, 0x118, 0x118, 0x118, 0x118, 0x118,
+  0x118, 0x118, 0x118, 0x118, 0x67, 0x118, 0x67, 0x118, 0x118, 0x118, 0x118, 0x118, 0x118, 0x118, 0x118, 0x118,
+  0x118, 0x118, 0x118, 0x118, 0x118, 0x118, 0x118, 0x118, 0x118, 0x118, 0x18, 0x118, 0x118, 0x118, 0x67, 0x67,
+  0x118, 0x118, 0x118, 0x118, 0x118, 0x67, 0x118, 0x67, 0x18, 0x18, 0x18, 0x18, 0x18, 0x118, 0x18, 0x67,
+  0x618, 0x618, 0x618, 0x618, 0x618, 0x618, 0x618, 0x618, 0x618, 0x618, 0x67, 0x67, 0x118, 0x118, 0x118, 0x118,
+  0x127, 0x27, 0x27, 0x27, 0x827, 0x827, 0x827, 0x827, 0x827, 0x827, 0x827, 0x827, 0x827, 0x827, 0x827, 0x827,
+  0x827, 0x827, 0x827, 0x27, 0x827, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+  0x627, 0x627, 0x627, 0x627, 0x627, 0x627, 0x627, 0x627, 0x627, 0x627, 0x427, 0x427, 0x427, 0x427, 0x427, 0x427,
+  0x427, 0x427, 0x427, 0x427, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x827, 0x827, 0x827, 0x827, 0x27, 0x27,
+  0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x67, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127,
+  0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127,
+  0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x67, 0x67, 0x67,
+  0x67, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127,
+  0x127, 0x127, 0x127, 0x127, 0x27, 0x827, 0x27, 0x27, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127,
+  0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x127, 0x67, 0x27, 0x27,
+  0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x67, 0x27, 0x27,
+  0x827, 0x827, 0x827, 0x827, 0x827, 0x0, 0x0, 0x0, 0x0, 0x827, 0x827, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x11c, 0x11c, 0x11c, 0x11c, 0x11c, 0x11c, 0x11c, 0x11c, 0x11c, 0x11c, 0x11c, 0x11c, 0x11c, 0x11c, 0x11c, 0x11c,
+  0x11c, 0x11c, 0x11c, 0x11c, 0x11c, 0x11c, 0x11c, 0x1c, 0x11c, 0x1c, 0x1c, 0x11c, 0x11c, 0x11c, 0x11c, 0x11c,
+  0x61c, 0x61c, 0x61c, 0x61c, 0x61c, 0x61c, 0x61c, 0x61c, 0x61c, 0x61c, 0x81c, 0x81c, 0x81c, 0x81c, 0x81c, 0x81c,
+  0x61c, 0x61c, 0x61c, 0x61c, 0x61c, 0x61c, 0x61c, 0x61c, 0x61c, 0x61c, 0x11c, 0x11c, 0x11c, 0x11c, 0x1c, 0x1c,
+  0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x10c,
+  0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x67, 0x10c, 0x67, 0x67, 0x67, 0x67, 0x67, 0x10c, 0x67, 0x67,
+  0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x800, 0x10c, 0x10c, 0x10c, 0x10c,
+  0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112,
+  0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b,
+  0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x67, 0x10b, 0x10b, 0x10b, 0x10b, 0x67, 0x67,
+  0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x67, 0x10b, 0x67, 0x10b, 0x10b, 0x10b, 0x10b, 0x67, 0x67,
+  0x10b, 0x67, 0x10b, 0x10b, 0x10b, 0x10b, 0x67, 0x67, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x67,
+  0x10b, 0x67, 0x10b, 0x10b, 0x10b, 0x10b, 0x67, 0x67, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b,
+  0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x67, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b,
+  0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x67, 0x67, 0xb, 0xb, 0xb,
+  0x80b, 0x80b, 0x80b, 0x80b, 0x80b, 0x80b, 0x80b, 0x80b, 0x80b, 0x40b, 0x40b, 0x40b, 0x40b, 0x40b, 0x40b, 0x40b,
+  0x40b, 0x40b, 0x40b, 0x40b, 0x40b, 0x40b, 0x40b, 0x40b, 0x40b, 0x40b, 0x40b, 0x40b, 0x40b, 0x67, 0x67, 0x67,
+  0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x106, 0x106, 0x106, 0x106, 0x106, 0x106, 0x106, 0x106, 0x106, 0x106, 0x106, 0x106, 0x106, 0x106, 0x106, 0x106,
+  0x106, 0x106, 0x106, 0x106, 0x106, 0x106, 0x67, 0x67, 0x106, 0x106, 0x106, 0x106, 0x106, 0x106, 0x67, 0x67,
+  0x828, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128,
+  0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128,
+  0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x28, 0x828, 0x128,
+  0x101d, 0x11d, 0x11d, 0x11d, 0x11d, 0x11d, 0x11d, 0x11d, 0x11d, 0x11d, 0x11d, 0x11d, 0x11d, 0x11d, 0x11d, 0x11d,
+  0x11d, 0x11d, 0x11d, 0x11d, 0x11d, 0x11d, 0x11d, 0x11d, 0x11d, 0x11d, 0x11d, 0x81d, 0x81d, 0x67, 0x67, 0x67,
+  0x120, 0x120, 0x120, 0x120, 0x120, 0x120, 0x120, 0x120, 0x120, 0x120, 0x120, 0x120, 0x120, 0x120, 0x120, 0x120,
+  0x120, 0x120, 0x120, 0x120, 0x120, 0x120, 0x120, 0x120, 0x120, 0x120, 0x120, 0x800, 0x800, 0x800, 0x520, 0x520,
+  0x520, 0x120, 0x120, 0x120, 0x120, 0x120, 0x120, 0x120, 0x120, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x12a, 0x12a, 0x12a, 0x12a, 0x12a, 0x12a, 0x12a, 0x12a, 0x12a, 0x12a, 0x12a, 0x12a, 0x12a, 0x12a, 0x12a, 0x12a,
+  0x12a, 0x12a, 0x12a, 0x12a, 0x2a, 0x2a, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x12a,
+  0x12b, 0x12b, 0x12b, 0x12b, 0x12b, 0x12b, 0x12b, 0x12b, 0x12b, 0x12b, 0x12b, 0x12b, 0x12b, 0x12b, 0x12b, 0x12b,
+  0x12b, 0x12b, 0x12b, 0x12b, 0x2b, 0x800, 0x800, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x12c, 0x12c, 0x12c, 0x12c, 0x12c, 0x12c, 0x12c, 0x12c, 0x12c, 0x12c, 0x12c, 0x12c, 0x12c, 0x12c, 0x12c, 0x12c,
+  0x12c, 0x12c, 0x12c, 0x12c, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x12d, 0x12d, 0x12d, 0x12d, 0x12d, 0x12d, 0x12d, 0x12d, 0x12d, 0x12d, 0x12d, 0x12d, 0x12d, 0x67, 0x12d, 0x12d,
+  0x12d, 0x67, 0x12d, 0x12d, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x117, 0x117, 0x117, 0x117, 0x117, 0x117, 0x117, 0x117, 0x117, 0x117, 0x117, 0x117, 0x117, 0x117, 0x117, 0x117,
+  0x117, 0x117, 0x117, 0x117, 0x17, 0x17, 0x117, 0x117, 0x117, 0x117, 0x117, 0x117, 0x117, 0x117, 0x117, 0x117,
+  0x117, 0x117, 0x117, 0x117, 0x117, 0x117, 0x117, 0x117, 0x117, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+  0x17, 0x17, 0x17, 0x17, 0x817, 0x817, 0x817, 0x117, 0x817, 0x817, 0x817, 0x17, 0x117, 0x17, 0x67, 0x67,
+  0x617, 0x617, 0x617, 0x617, 0x617, 0x617, 0x617, 0x617, 0x617, 0x617, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x417, 0x417, 0x417, 0x417, 0x417, 0x417, 0x417, 0x417, 0x417, 0x417, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x81b, 0x81b, 0x800, 0x800, 0x81b, 0x800, 0x81b, 0x81b, 0x81b, 0x81b, 0x81b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
+  0x61b, 0x61b, 0x61b, 0x61b, 0x61b, 0x61b, 0x61b, 0x61b, 0x61b, 0x61b, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x11b, 0x11b, 0x11b, 0x11b, 0x11b, 0x11b, 0x11b, 0x11b, 0x11b, 0x11b, 0x11b, 0x11b, 0x11b, 0x11b, 0x11b, 0x11b,
+  0x11b, 0x11b, 0x11b, 0x11b, 0x11b, 0x11b, 0x11b, 0x11b, 0x11b, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x11b, 0x11b, 0x11b, 0x11b, 0x11b, 0x11b, 0x11b, 0x11b, 0x11b, 0x11b, 0x11b, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x128, 0x128, 0x128, 0x128, 0x128, 0x128, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130,
+  0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x67,
+  0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x67, 0x67, 0x67, 0x67,
+  0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x130, 0x30, 0x30, 0x30, 0x67, 0x67, 0x67, 0x67,
+  0x30, 0x67, 0x67, 0x67, 0x830, 0x830, 0x630, 0x630, 0x630, 0x630, 0x630, 0x630, 0x630, 0x630, 0x630, 0x630,
+  0x134, 0x134, 0x134, 0x134, 0x134, 0x134, 0x134, 0x134, 0x134, 0x134, 0x134, 0x134, 0x134, 0x134, 0x134, 0x134,
+  0x134, 0x134, 0x134, 0x134, 0x134, 0x134, 0x134, 0x134, 0x134, 0x134, 0x134, 0x134, 0x134, 0x134, 0x67, 0x67,
+  0x134, 0x134, 0x134, 0x134, 0x134, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x13b, 0x13b, 0x13b, 0x13b, 0x13b, 0x13b, 0x13b, 0x13b, 0x13b, 0x13b, 0x13b, 0x13b, 0x13b, 0x13b, 0x13b, 0x13b,
+  0x13b, 0x13b, 0x13b, 0x13b, 0x13b, 0x13b, 0x13b, 0x13b, 0x13b, 0x13b, 0x13b, 0x13b, 0x67, 0x67, 0x67, 0x67,
+  0x13b, 0x13b, 0x13b, 0x13b, 0x13b, 0x13b, 0x13b, 0x13b, 0x13b, 0x13b, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x63b, 0x63b, 0x63b, 0x63b, 0x63b, 0x63b, 0x63b, 0x63b, 0x63b, 0x63b, 0x43b, 0x67, 0x67, 0x67, 0x3b, 0x3b,
+  0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+  0x137, 0x137, 0x137, 0x137, 0x137, 0x137, 0x137, 0x137, 0x137, 0x137, 0x137, 0x137, 0x137, 0x137, 0x137, 0x137,
+  0x137, 0x137, 0x137, 0x137, 0x137, 0x137, 0x137, 0x137, 0x137, 0x137, 0x137, 0x137, 0x67, 0x67, 0x837, 0x837,
+  0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a,
+  0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x67,
+  0x6a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x16a,
+  0x16a, 0x16a, 0x16a, 0x16a, 0x16a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x67, 0x67, 0x6a,
+  0x66a, 0x66a, 0x66a, 0x66a, 0x66a, 0x66a, 0x66a, 0x66a, 0x66a, 0x66a, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x86a, 0x86a, 0x86a, 0x86a, 0x86a, 0x86a, 0x86a, 0x16a, 0x86a, 0x86a, 0x86a, 0x86a, 0x86a, 0x86a, 0x67, 0x67,
+  0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x101,
+  0x101, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x101, 0x101, 0x101, 0x67,
+  0x13e, 0x13e, 0x13e, 0x13e, 0x13e, 0x13e, 0x13e, 0x13e, 0x13e, 0x13e, 0x13e, 0x13e, 0x13e, 0x13e, 0x13e, 0x13e,
+  0x13e, 0x13e, 0x13e, 0x13e, 0x3e, 0x13e, 0x13e, 0x13e, 0x13e, 0x13e, 0x13e, 0x13e, 0x13e, 0x13e, 0x13e, 0x13e,
+  0x13e, 0x13e, 0x13e, 0x13e, 0x3e, 0x13e, 0x13e, 0x13e, 0x13e, 0x13e, 0x13e, 0x13e, 0x13e, 0x67, 0x67, 0x67,
+  0x63e, 0x63e, 0x63e, 0x63e, 0x63e, 0x63e, 0x63e, 0x63e, 0x63e, 0x63e, 0x83e, 0x83e, 0x83e, 0x83e, 0x83e, 0x83e,
+  0x83e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e,
+  0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x83e, 0x83e, 0x67,
+  0x171, 0x171, 0x171, 0x171, 0x171, 0x171, 0x171, 0x171, 0x171, 0x171, 0x171, 0x171, 0x171, 0x171, 0x171, 0x171,
+  0x171, 0x171, 0x171, 0x171, 0x171, 0x171, 0x171, 0x171, 0x171, 0x171, 0x71, 0x71, 0x171, 0x171, 0x171, 0x171,
+  0x671, 0x671, 0x671, 0x671, 0x671, 0x671, 0x671, 0x671, 0x671, 0x671, 0x171, 0x171, 0x171, 0x171, 0x171, 0x171,
+  0x13f, 0x13f, 0x13f, 0x13f, 0x13f, 0x13f, 0x13f, 0x13f, 0x13f, 0x13f, 0x13f, 0x13f, 0x13f, 0x13f, 0x13f, 0x13f,
+  0x13f, 0x13f, 0x13f, 0x13f, 0x13f, 0x13f, 0x3f, 0x13f, 0x13f, 0x13f, 0x13f, 0x13f, 0x13f, 0x13f, 0x13f, 0x13f,
+  0x13f, 0x13f, 0x3f, 0x3f, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x83f, 0x83f, 0x83f, 0x83f,
+  0x152, 0x152, 0x152, 0x152, 0x152, 0x152, 0x152, 0x152, 0x152, 0x152, 0x152, 0x152, 0x152, 0x152, 0x152, 0x152,
+  0x152, 0x152, 0x152, 0x152, 0x152, 0x152, 0x152, 0x52, 0x67, 0x67, 0x67, 0x852, 0x852, 0x852, 0x852, 0x852,
+  0x652, 0x652, 0x652, 0x652, 0x652, 0x652, 0x652, 0x652, 0x652, 0x652, 0x67, 0x67, 0x67, 0x152, 0x152, 0x152,
+  0x66d, 0x66d, 0x66d, 0x66d, 0x66d, 0x66d, 0x66d, 0x66d, 0x66d, 0x66d, 0x16d, 0x16d, 0x16d, 0x16d, 0x16d, 0x16d,
+  0x16d, 0x16d, 0x16d, 0x16d, 0x16d, 0x16d, 0x16d, 0x16d, 0x16d, 0x16d, 0x16d, 0x16d, 0x16d, 0x16d, 0x16d, 0x16d,
+  0x16d, 0x16d, 0x16d, 0x16d, 0x16d, 0x16d, 0x16d, 0x16d, 0x16d, 0x16d, 0x16d, 0x16d, 0x16d, 0x16d, 0x86d, 0x86d,
+  0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x10c, 0x67, 0x67, 0x10c, 0x10c, 0x10c,
+  0x871, 0x871, 0x871, 0x871, 0x871, 0x871, 0x871, 0x871, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x1, 0x1, 0x1, 0x800, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+  0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x100, 0x100, 0x100, 0x100, 0x1, 0x100, 0x100,
+  0x100, 0x100, 0x100, 0x100, 0x1, 0x100, 0x100, 0x0, 0x1, 0x1, 0x100, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x108, 0x119, 0x119, 0x119, 0x119,
+  0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x10e, 0x10e, 0x10e,
+  0x10e, 0x10e, 0x119, 0x119, 0x119, 0x119, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x119, 0x119, 0x119, 0x119, 0x119,
+  0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x108, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119,
+  0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x10e,
+  0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x101, 0x101, 0x101, 0x101, 0x101, 0x101, 0x101, 0x101, 0x101,
+  0x101, 0x101, 0x101, 0x101, 0x101, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+  0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x67, 0x67, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x67, 0x67,
+  0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x67, 0x10e, 0x67, 0x10e, 0x67, 0x10e, 0x67, 0x10e,
+  0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x67, 0x67,
+  0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x67, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0xe, 0x10e, 0xe,
+  0xe, 0xe, 0x10e, 0x10e, 0x10e, 0x67, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0xe, 0xe, 0xe,
+  0x10e, 0x10e, 0x10e, 0x10e, 0x67, 0x67, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x67, 0xe, 0xe, 0xe,
+  0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0xe, 0xe, 0xe,
+  0x67, 0x67, 0x10e, 0x10e, 0x10e, 0x67, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0x10e, 0xe, 0xe, 0x67,
+  0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x0, 0x1, 0x1, 0x0, 0x0,
+  0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800,
+  0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x1000, 0x1000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000,
+  0x800, 0x800, 0x800, 0x800, 0x0, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800,
+  0x800, 0x800, 0x0, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x1000,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x67, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x400, 0x119, 0x67, 0x67, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x0, 0x0, 0x0, 0x800, 0x800, 0x119,
+  0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x0, 0x0, 0x0, 0x800, 0x800, 0x67,
+  0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x67, 0x67, 0x67,
+  0x0, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x1, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x0, 0x0, 0x100, 0x0, 0x0, 0x0, 0x0, 0x100, 0x0, 0x0, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+  0x100, 0x100, 0x100, 0x100, 0x0, 0x100, 0x0, 0x0, 0x0, 0x100, 0x100, 0x100, 0x100, 0x100, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x100, 0x0, 0x10e, 0x0, 0x100, 0x0, 0x119, 0x119, 0x100, 0x100, 0x0, 0x100,
+  0x100, 0x100, 0x119, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x0, 0x0, 0x100, 0x100, 0x100, 0x100,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x100, 0x100, 0x100, 0x100, 0x100, 0x0, 0x0, 0x0, 0x0, 0x119, 0x0,
+  0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400,
+  0x519, 0x519, 0x519, 0x519, 0x519, 0x519, 0x519, 0x519, 0x519, 0x519, 0x519, 0x519, 0x519, 0x519, 0x519, 0x519,
+  0x519, 0x519, 0x519, 0x119, 0x119, 0x519, 0x519, 0x519, 0x519, 0x400, 0x0, 0x0, 0x67, 0x67, 0x67, 0x67,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x800, 0x800, 0x800, 0x800, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x800, 0x800, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+  0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+  0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800,
+  0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400,
+  0x400, 0x400, 0x400, 0x400, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x800, 0x800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x0, 0x0, 0x0, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800,
+  0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x800, 0x800, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x67, 0x67, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x67, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x138, 0x138, 0x138, 0x138, 0x138, 0x138, 0x138, 0x138, 0x138, 0x138, 0x138, 0x138, 0x138, 0x138, 0x138, 0x138,
+  0x107, 0x107, 0x107, 0x107, 0x107, 0x107, 0x107, 0x107, 0x107, 0x107, 0x107, 0x107, 0x107, 0x107, 0x107, 0x107,
+  0x107, 0x107, 0x107, 0x107, 0x107, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x107, 0x107, 0x107, 0x107, 0x7,
+  0x7, 0x7, 0x107, 0x107, 0x67, 0x67, 0x67, 0x67, 0x67, 0x807, 0x807, 0x807, 0x807, 0x407, 0x807, 0x807,
+  0x13c, 0x13c, 0x13c, 0x13c, 0x13c, 0x13c, 0x13c, 0x13c, 0x13c, 0x13c, 0x13c, 0x13c, 0x13c, 0x13c, 0x13c, 0x13c,
+  0x13c, 0x13c, 0x13c, 0x13c, 0x13c, 0x13c, 0x13c, 0x13c, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x13c,
+  0x83c, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x3c,
+  0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x67, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x67,
+  0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x100,
+  0x0, 0x0, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x67, 0x67,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x67, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x67, 0x67, 0x67, 0x67,
+  0x1000, 0x800, 0x800, 0x800, 0x0, 0x111, 0x100, 0x511, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800,
+  0x800, 0x800, 0x0, 0x0, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800,
+  0x0, 0x511, 0x511, 0x511, 0x511, 0x511, 0x511, 0x511, 0x511, 0x511, 0x1, 0x1, 0x1, 0x1, 0x12, 0x12,
+  0x800, 0x100, 0x100, 0x100, 0x100, 0x100, 0x0, 0x0, 0x511, 0x511, 0x511, 0x111, 0x100, 0x800, 0x0, 0x0,
+  0x67, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114,
+  0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114,
+  0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x67, 0x67, 0x1, 0x1, 0x0, 0x0, 0x114, 0x114, 0x114,
+  0x800, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116,
+  0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116,
+  0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x800, 0x100, 0x116, 0x116, 0x116,
+  0x67, 0x67, 0x67, 0x67, 0x67, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105,
+  0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105,
+  0x67, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112,
+  0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x67,
+  0x0, 0x0, 0x400, 0x400, 0x400, 0x400, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+  0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x67,
+  0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400,
+  0x0, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400,
+  0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0,
+  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x0,
+  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111,
+  0x129, 0x129, 0x129, 0x129, 0x129, 0x129, 0x129, 0x129, 0x129, 0x129, 0x129, 0x129, 0x129, 0x129, 0x129, 0x129,
+  0x129, 0x129, 0x129, 0x129, 0x129, 0x129, 0x129, 0x129, 0x129, 0x129, 0x129, 0x129, 0x129, 0x67, 0x67, 0x67,
+  0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+  0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x183, 0x183, 0x183, 0x183, 0x183, 0x183, 0x183, 0x183, 0x183, 0x183, 0x183, 0x183, 0x183, 0x183, 0x183, 0x183,
+  0x183, 0x183, 0x183, 0x183, 0x183, 0x183, 0x183, 0x183, 0x183, 0x183, 0x183, 0x183, 0x183, 0x183, 0x883, 0x883,
+  0x163, 0x163, 0x163, 0x163, 0x163, 0x163, 0x163, 0x163, 0x163, 0x163, 0x163, 0x163, 0x163, 0x163, 0x163, 0x163,
+  0x163, 0x163, 0x163, 0x163, 0x163, 0x163, 0x163, 0x163, 0x163, 0x163, 0x163, 0x163, 0x163, 0x863, 0x863, 0x863,
+  0x663, 0x663, 0x663, 0x663, 0x663, 0x663, 0x663, 0x663, 0x663, 0x663, 0x163, 0x163, 0x67, 0x67, 0x67, 0x67,
+  0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x8,
+  0x8, 0x8, 0x8, 0x808, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x8, 0x8, 0x808, 0x108,
+  0x182, 0x182, 0x182, 0x182, 0x182, 0x182, 0x182, 0x182, 0x182, 0x182, 0x182, 0x182, 0x182, 0x182, 0x182, 0x182,
+  0x182, 0x182, 0x182, 0x182, 0x182, 0x182, 0x582, 0x582, 0x582, 0x582, 0x582, 0x582, 0x582, 0x582, 0x582, 0x582,
+  0x82, 0x82, 0x882, 0x882, 0x882, 0x882, 0x882, 0x882, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+  0x0, 0x0, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119,
+  0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x100, 0x0, 0x0, 0x119, 0x119, 0x119, 0x119, 0x119,
+  0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x119, 0x119, 0x67, 0x119, 0x67, 0x119, 0x119, 0x119, 0x119, 0x119, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x67, 0x67, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119,
+  0x13a, 0x13a, 0x13a, 0x13a, 0x13a, 0x13a, 0x3a, 0x13a, 0x13a, 0x13a, 0x13a, 0x13a, 0x13a, 0x13a, 0x13a, 0x13a,
+  0x13a, 0x13a, 0x13a, 0x13a, 0x13a, 0x13a, 0x13a, 0x13a, 0x13a, 0x13a, 0x13a, 0x13a, 0x13a, 0x13a, 0x13a, 0x13a,
+  0x13a, 0x13a, 0x13a, 0x13a, 0x13a, 0x13a, 0x13a, 0x13a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x67, 0x67, 0x67,
+  0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x0, 0x0, 0x0, 0x0, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x15a, 0x15a, 0x15a, 0x15a, 0x15a, 0x15a, 0x15a, 0x15a, 0x15a, 0x15a, 0x15a, 0x15a, 0x15a, 0x15a, 0x15a, 0x15a,
+  0x15a, 0x15a, 0x15a, 0x15a, 0x85a, 0x85a, 0x85a, 0x85a, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x16f, 0x16f, 0x16f, 0x16f, 0x16f, 0x16f, 0x16f, 0x16f, 0x16f, 0x16f, 0x16f, 0x16f, 0x16f, 0x16f, 0x16f, 0x16f,
+  0x16f, 0x16f, 0x16f, 0x16f, 0x6f, 0x16f, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x86f, 0x86f,
+  0x66f, 0x66f, 0x66f, 0x66f, 0x66f, 0x66f, 0x66f, 0x66f, 0x66f, 0x66f, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+  0xa, 0xa, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x10a, 0x80a, 0x80a, 0x80a, 0x10a, 0x80a, 0x10a, 0x10a, 0x10a,
+  0x64f, 0x64f, 0x64f, 0x64f, 0x64f, 0x64f, 0x64f, 0x64f, 0x64f, 0x64f, 0x14f, 0x14f, 0x14f, 0x14f, 0x14f, 0x14f,
+  0x14f, 0x14f, 0x14f, 0x14f, 0x14f, 0x14f, 0x14f, 0x14f, 0x14f, 0x14f, 0x14f, 0x14f, 0x14f, 0x14f, 0x14f, 0x14f,
+  0x14f, 0x14f, 0x14f, 0x14f, 0x14f, 0x14f, 0x14f, 0x14f, 0x14f, 0x14f, 0x14f, 0x4f, 0x4f, 0x4f, 0x800, 0x84f,
+  0x16e, 0x16e, 0x16e, 0x16e, 0x16e, 0x16e, 0x16e, 0x16e, 0x16e, 0x16e, 0x16e, 0x16e, 0x16e, 0x16e, 0x16e, 0x16e,
+  0x16e, 0x16e, 0x16e, 0x6e, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x86e,
+  0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x67, 0x67, 0x67,
+  0x14e, 0x14e, 0x14e, 0x14e, 0x14e, 0x14e, 0x14e, 0x14e, 0x14e, 0x14e, 0x14e, 0x14e, 0x14e, 0x14e, 0x14e, 0x14e,
+  0x14e, 0x14e, 0x14e, 0x4e, 0x14e, 0x14e, 0x14e, 0x14e, 0x14e, 0x14e, 0x14e, 0x14e, 0x14e, 0x14e, 0x14e, 0x14e,
+  0x4e, 0x84e, 0x84e, 0x84e, 0x84e, 0x84e, 0x84e, 0x84e, 0x84e, 0x84e, 0x84e, 0x84e, 0x84e, 0x84e, 0x67, 0x100,
+  0x64e, 0x64e, 0x64e, 0x64e, 0x64e, 0x64e, 0x64e, 0x64e, 0x64e, 0x64e, 0x67, 0x67, 0x67, 0x67, 0x84e, 0x84e,
+  0x61c, 0x61c, 0x61c, 0x61c, 0x61c, 0x61c, 0x61c, 0x61c, 0x61c, 0x61c, 0x11c, 0x11c, 0x11c, 0x11c, 0x11c, 0x67,
+  0x142, 0x142, 0x142, 0x142, 0x142, 0x142, 0x142, 0x142, 0x142, 0x142, 0x142, 0x142, 0x142, 0x142, 0x142, 0x142,
+  0x142, 0x142, 0x142, 0x142, 0x142, 0x142, 0x142, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x142, 0x142, 0x142, 0x142, 0x142, 0x142, 0x142, 0x142, 0x142, 0x142, 0x142, 0x142, 0x142, 0x142, 0x67, 0x67,
+  0x642, 0x642, 0x642, 0x642, 0x642, 0x642, 0x642, 0x642, 0x642, 0x642, 0x67, 0x67, 0x842, 0x842, 0x842, 0x842,
+  0x11c, 0x11c, 0x11c, 0x11c, 0x11c, 0x11c, 0x11c, 0x1c, 0x1c, 0x1c, 0x11c, 0x11c, 0x11c, 0x11c, 0x11c, 0x11c,
+  0x17f, 0x17f, 0x17f, 0x17f, 0x17f, 0x17f, 0x17f, 0x17f, 0x17f, 0x17f, 0x17f, 0x17f, 0x17f, 0x17f, 0x17f, 0x17f,
+  0x17f, 0x17f, 0x17f, 0x17f, 0x17f, 0x17f, 0x17f, 0x17f, 0x17f, 0x17f, 0x17f, 0x17f, 0x17f, 0x17f, 0x17f, 0x7f,
+  0x17f, 0x7f, 0x17f, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x17f, 0x17f, 0x17f, 0x87f, 0x87f,
+  0x173, 0x173, 0x173, 0x173, 0x173, 0x173, 0x173, 0x173, 0x173, 0x173, 0x173, 0x173, 0x173, 0x173, 0x173, 0x173,
+  0x873, 0x873, 0x173, 0x173, 0x173, 0x173, 0x73, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x67, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x67, 0x67, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x67,
+  0x67, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x0, 0x119, 0x119, 0x119, 0x119,
+  0x119, 0x119, 0x119, 0x119, 0x119, 0x10e, 0x119, 0x119, 0x119, 0x119, 0x0, 0x0, 0x67, 0x67, 0x67, 0x67,
+  0x173, 0x173, 0x173, 0x173, 0x173, 0x173, 0x173, 0x173, 0x173, 0x173, 0x173, 0x873, 0x73, 0x73, 0x67, 0x67,
+  0x673, 0x673, 0x673, 0x673, 0x673, 0x673, 0x673, 0x673, 0x673, 0x673, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x112, 0x112, 0x112, 0x112, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x67, 0x67, 0x67, 0x67, 0x112, 0x112, 0x112, 0x112, 0x112,
+  0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x67, 0x67, 0x67, 0x67,
+  0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x67, 0x67,
+  0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x67, 0x67, 0x67, 0x103, 0x103, 0x103, 0x103, 0x103, 0x67, 0x67, 0x67, 0x67, 0x67, 0x113, 0x113, 0x113,
+  0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x13, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113,
+  0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x67, 0x113, 0x113, 0x113, 0x113, 0x113, 0x67, 0x113, 0x67,
+  0x113, 0x113, 0x67, 0x113, 0x113, 0x67, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113,
+  0x102, 0x102, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+  0x2, 0x2, 0x2, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x67, 0x67, 0x67, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102,
+  0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x800, 0x800,
+  0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+  0x67, 0x67, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102,
+  0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x2,
+  0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x2, 0x2, 0x2, 0x2,
+  0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x8, 0x8,
+  0x800, 0x800, 0x800, 0x67, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800,
+  0x800, 0x800, 0x0, 0x800, 0x0, 0x0, 0x0, 0x67, 0x800, 0x0, 0x800, 0x800, 0x67, 0x67, 0x67, 0x67,
+  0x102, 0x102, 0x102, 0x102, 0x102, 0x67, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102,
+  0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x67, 0x67, 0x0,
+  0x67, 0x800, 0x800, 0x800, 0x0, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x0, 0x800, 0x800, 0x800, 0x800,
+  0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x800, 0x0, 0x800, 0x0, 0x800,
+  0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116,
+  0x100, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116,
+  0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x100, 0x100,
+  0x67, 0x67, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x67, 0x67, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112,
+  0x67, 0x67, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x67, 0x67, 0x112, 0x112, 0x112, 0x67, 0x67, 0x67,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x67, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x67,
+  0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x0, 0x0, 0x0, 0x0, 0x0, 0x67, 0x67,
+  0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x67, 0x131, 0x131, 0x131,
+  0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131,
+  0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x67, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131,
+  0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x67, 0x131, 0x131, 0x67, 0x131,
+  0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x67, 0x67,
+  0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x131, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x800, 0x800, 0x800, 0x67, 0x67, 0x67, 0x67, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400,
+  0x400, 0x400, 0x400, 0x400, 0x67, 0x67, 0x67, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x50e, 0x50e, 0x50e, 0x50e, 0x50e, 0x50e, 0x50e, 0x50e, 0x50e, 0x50e, 0x50e, 0x50e, 0x50e, 0x50e, 0x50e, 0x50e,
+  0x50e, 0x50e, 0x50e, 0x50e, 0x50e, 0x40e, 0x40e, 0x40e, 0x40e, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe,
+  0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0x40e, 0x40e, 0xe, 0xe, 0xe, 0x67,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x67, 0x67, 0x67,
+  0xe, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x67, 0x67,
+  0x16b, 0x16b, 0x16b, 0x16b, 0x16b, 0x16b, 0x16b, 0x16b, 0x16b, 0x16b, 0x16b, 0x16b, 0x16b, 0x16b, 0x16b, 0x16b,
+  0x16b, 0x16b, 0x16b, 0x16b, 0x16b, 0x16b, 0x16b, 0x16b, 0x16b, 0x16b, 0x16b, 0x16b, 0x16b, 0x67, 0x67, 0x67,
+  0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168, 0x168,
+  0x168, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x1, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400,
+  0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x67, 0x67, 0x67, 0x67,
+  0x11e, 0x11e, 0x11e, 0x11e, 0x11e, 0x11e, 0x11e, 0x11e, 0x11e, 0x11e, 0x11e, 0x11e, 0x11e, 0x11e, 0x11e, 0x11e,
+  0x41e, 0x41e, 0x41e, 0x41e, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x11e, 0x11e, 0x11e,
+  0x10d, 0x10d, 0x10d, 0x10d, 0x10d, 0x10d, 0x10d, 0x10d, 0x10d, 0x10d, 0x10d, 0x10d, 0x10d, 0x10d, 0x10d, 0x10d,
+  0x10d, 0x50d, 0x10d, 0x10d, 0x10d, 0x10d, 0x10d, 0x10d, 0x10d, 0x10d, 0x50d, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x159, 0x159, 0x159, 0x159, 0x159, 0x159, 0x159, 0x159, 0x159, 0x159, 0x159, 0x159, 0x159, 0x159, 0x159, 0x159,
+  0x159, 0x159, 0x159, 0x159, 0x159, 0x159, 0x159, 0x159, 0x159, 0x159, 0x159, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x135, 0x135, 0x135, 0x135, 0x135, 0x135, 0x135, 0x135, 0x135, 0x135, 0x135, 0x135, 0x135, 0x135, 0x135, 0x135,
+  0x135, 0x135, 0x135, 0x135, 0x135, 0x135, 0x135, 0x135, 0x135, 0x135, 0x135, 0x135, 0x135, 0x135, 0x67, 0x835,
+  0x13d, 0x13d, 0x13d, 0x13d, 0x13d, 0x13d, 0x13d, 0x13d, 0x13d, 0x13d, 0x13d, 0x13d, 0x13d, 0x13d, 0x13d, 0x13d,
+  0x13d, 0x13d, 0x13d, 0x13d, 0x67, 0x67, 0x67, 0x67, 0x13d, 0x13d, 0x13d, 0x13d, 0x13d, 0x13d, 0x13d, 0x13d,
+  0x83d, 0x53d, 0x53d, 0x53d, 0x53d, 0x53d, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x109, 0x109, 0x109, 0x109, 0x109, 0x109, 0x109, 0x109, 0x109, 0x109, 0x109, 0x109, 0x109, 0x109, 0x109, 0x109,
+  0x133, 0x133, 0x133, 0x133, 0x133, 0x133, 0x133, 0x133, 0x133, 0x133, 0x133, 0x133, 0x133, 0x133, 0x133, 0x133,
+  0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132,
+  0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x132, 0x67, 0x67,
+  0x632, 0x632, 0x632, 0x632, 0x632, 0x632, 0x632, 0x632, 0x632, 0x632, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x1ab, 0x1ab, 0x1ab, 0x1ab, 0x1ab, 0x1ab, 0x1ab, 0x1ab, 0x1ab, 0x1ab, 0x1ab, 0x1ab, 0x1ab, 0x1ab, 0x1ab, 0x1ab,
+  0x1ab, 0x1ab, 0x1ab, 0x1ab, 0x67, 0x67, 0x67, 0x67, 0x1ab, 0x1ab, 0x1ab, 0x1ab, 0x1ab, 0x1ab, 0x1ab, 0x1ab,
+  0x1ab, 0x1ab, 0x1ab, 0x1ab, 0x1ab, 0x1ab, 0x1ab, 0x1ab, 0x1ab, 0x1ab, 0x1ab, 0x1ab, 0x67, 0x67, 0x67, 0x67,
+  0x188, 0x188, 0x188, 0x188, 0x188, 0x188, 0x188, 0x188, 0x188, 0x188, 0x188, 0x188, 0x188, 0x188, 0x188, 0x188,
+  0x188, 0x188, 0x188, 0x188, 0x188, 0x188, 0x188, 0x188, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x19f, 0x19f, 0x19f, 0x19f, 0x19f, 0x19f, 0x19f, 0x19f, 0x19f, 0x19f, 0x19f, 0x19f, 0x19f, 0x19f, 0x19f, 0x19f,
+  0x19f, 0x19f, 0x19f, 0x19f, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x89f,
+  0x1c5, 0x1c5, 0x1c5, 0x1c5, 0x1c5, 0x1c5, 0x1c5, 0x1c5, 0x1c5, 0x1c5, 0x1c5, 0x67, 0x1c5, 0x1c5, 0x1c5, 0x1c5,
+  0x1c5, 0x1c5, 0x1c5, 0x67, 0x1c5, 0x1c5, 0x67, 0x1c5, 0x1c5, 0x1c5, 0x1c5, 0x1c5, 0x1c5, 0x1c5, 0x1c5, 0x1c5,
+  0x1c5, 0x1c5, 0x67, 0x1c5, 0x1c5, 0x1c5, 0x1c5, 0x1c5, 0x1c5, 0x1c5, 0x1c5, 0x1c5, 0x1c5, 0x1c5, 0x1c5, 0x1c5,
+  0x1c5, 0x1c5, 0x67, 0x1c5, 0x1c5, 0x1c5, 0x1c5, 0x1c5, 0x1c5, 0x1c5, 0x67, 0x1c5, 0x1c5, 0x67, 0x67, 0x67,
+  0x153, 0x153, 0x153, 0x153, 0x153, 0x153, 0x153, 0x153, 0x153, 0x153, 0x153, 0x153, 0x153, 0x153, 0x153, 0x153,
+  0x153, 0x153, 0x153, 0x153, 0x153, 0x153, 0x153, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x153, 0x153, 0x153, 0x153, 0x153, 0x153, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x153, 0x153, 0x153, 0x153, 0x153, 0x153, 0x153, 0x153, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x67, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119,
+  0x119, 0x67, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x12f, 0x12f, 0x12f, 0x12f, 0x12f, 0x12f, 0x67, 0x67, 0x12f, 0x67, 0x12f, 0x12f, 0x12f, 0x12f, 0x12f, 0x12f,
+  0x12f, 0x12f, 0x12f, 0x12f, 0x12f, 0x12f, 0x12f, 0x12f, 0x12f, 0x12f, 0x12f, 0x12f, 0x12f, 0x12f, 0x12f, 0x12f,
+  0x12f, 0x12f, 0x12f, 0x12f, 0x12f, 0x12f, 0x67, 0x12f, 0x12f, 0x67, 0x67, 0x67, 0x12f, 0x67, 0x67, 0x12f,
+  0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x174,
+  0x174, 0x174, 0x174, 0x174, 0x174, 0x174, 0x67, 0x874, 0x474, 0x474, 0x474, 0x474, 0x474, 0x474, 0x474, 0x474,
+  0x190, 0x190, 0x190, 0x190, 0x190, 0x190, 0x190, 0x190, 0x190, 0x190, 0x190, 0x190, 0x190, 0x190, 0x190, 0x190,
+  0x190, 0x190, 0x190, 0x190, 0x190, 0x190, 0x190, 0x90, 0x90, 0x490, 0x490, 0x490, 0x490, 0x490, 0x490, 0x490,
+  0x18f, 0x18f, 0x18f, 0x18f, 0x18f, 0x18f, 0x18f, 0x18f, 0x18f, 0x18f, 0x18f, 0x18f, 0x18f, 0x18f, 0x18f, 0x18f,
+  0x18f, 0x18f, 0x18f, 0x18f, 0x18f, 0x18f, 0x18f, 0x18f, 0x18f, 0x18f, 0x18f, 0x18f, 0x18f, 0x18f, 0x18f, 0x67,
+  0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x48f, 0x48f, 0x48f, 0x48f, 0x48f, 0x48f, 0x48f, 0x48f, 0x48f,
+  0x1a2, 0x1a2, 0x1a2, 0x1a2, 0x1a2, 0x1a2, 0x1a2, 0x1a2, 0x1a2, 0x1a2, 0x1a2, 0x1a2, 0x1a2, 0x1a2, 0x1a2, 0x1a2,
+  0x1a2, 0x1a2, 0x1a2, 0x67, 0x1a2, 0x1a2, 0x67, 0x67, 0x67, 0x67, 0x67, 0x4a2, 0x4a2, 0x4a2, 0x4a2, 0x4a2,
+  0x15b, 0x15b, 0x15b, 0x15b, 0x15b, 0x15b, 0x15b, 0x15b, 0x15b, 0x15b, 0x15b, 0x15b, 0x15b, 0x15b, 0x15b, 0x15b,
+  0x15b, 0x15b, 0x15b, 0x15b, 0x15b, 0x15b, 0x45b, 0x45b, 0x45b, 0x45b, 0x45b, 0x45b, 0x67, 0x67, 0x67, 0x85b,
+  0x16c, 0x16c, 0x16c, 0x16c, 0x16c, 0x16c, 0x16c, 0x16c, 0x16c, 0x16c, 0x16c, 0x16c, 0x16c, 0x16c, 0x16c, 0x16c,
+  0x16c, 0x16c, 0x16c, 0x16c, 0x16c, 0x16c, 0x16c, 0x16c, 0x16c, 0x16c, 0x67, 0x67, 0x67, 0x67, 0x67, 0x86c,
+  0x156, 0x156, 0x156, 0x156, 0x156, 0x156, 0x156, 0x156, 0x156, 0x156, 0x156, 0x156, 0x156, 0x156, 0x156, 0x156,
+  0x18d, 0x18d, 0x18d, 0x18d, 0x18d, 0x18d, 0x18d, 0x18d, 0x18d, 0x18d, 0x18d, 0x18d, 0x18d, 0x18d, 0x18d, 0x18d,
+  0x18d, 0x18d, 0x18d, 0x18d, 0x18d, 0x18d, 0x18d, 0x18d, 0x67, 0x67, 0x67, 0x67, 0x48d, 0x48d, 0x18d, 0x18d,
+  0x48d, 0x48d, 0x48d, 0x48d, 0x48d, 0x48d, 0x48d, 0x48d, 0x48d, 0x48d, 0x48d, 0x48d, 0x48d, 0x48d, 0x48d, 0x48d,
+  0x67, 0x67, 0x48d, 0x48d, 0x48d, 0x48d, 0x48d, 0x48d, 0x48d, 0x48d, 0x48d, 0x48d, 0x48d, 0x48d, 0x48d, 0x48d,
+  0x139, 0x139, 0x139, 0x139, 0x67, 0x139, 0x139, 0x67, 0x67, 0x67, 0x67, 0x67, 0x139, 0x139, 0x139, 0x139,
+  0x139, 0x139, 0x139, 0x139, 0x67, 0x139, 0x139, 0x139, 0x67, 0x139, 0x139, 0x139, 0x139, 0x139, 0x139, 0x139,
+  0x139, 0x139, 0x139, 0x139, 0x139, 0x139, 0x139, 0x139, 0x139, 0x139, 0x139, 0x139, 0x139, 0x139, 0x139, 0x139,
+  0x139, 0x139, 0x139, 0x139, 0x139, 0x139, 0x67, 0x67, 0x39, 0x39, 0x39, 0x67, 0x67, 0x67, 0x67, 0x39,
+  0x439, 0x439, 0x439, 0x439, 0x439, 0x439, 0x439, 0x439, 0x439, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x839, 0x839, 0x839, 0x839, 0x839, 0x839, 0x839, 0x839, 0x839, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x185, 0x185, 0x185, 0x185, 0x185, 0x185, 0x185, 0x185, 0x185, 0x185, 0x185, 0x185, 0x185, 0x185, 0x185, 0x185,
+  0x185, 0x185, 0x185, 0x185, 0x185, 0x185, 0x185, 0x185, 0x185, 0x185, 0x185, 0x185, 0x185, 0x485, 0x485, 0x885,
+  0x18e, 0x18e, 0x18e, 0x18e, 0x18e, 0x18e, 0x18e, 0x18e, 0x18e, 0x18e, 0x18e, 0x18e, 0x18e, 0x18e, 0x18e, 0x18e,
+  0x18e, 0x18e, 0x18e, 0x18e, 0x18e, 0x18e, 0x18e, 0x18e, 0x18e, 0x18e, 0x18e, 0x18e, 0x18e, 0x48e, 0x48e, 0x48e,
+  0x179, 0x179, 0x179, 0x179, 0x179, 0x179, 0x179, 0x179, 0x79, 0x179, 0x179, 0x179, 0x179, 0x179, 0x179, 0x179,
+  0x179, 0x179, 0x179, 0x179, 0x179, 0x179, 0x179, 0x179, 0x179, 0x179, 0x179, 0x179, 0x179, 0x179, 0x179, 0x179,
+  0x179, 0x179, 0x179, 0x179, 0x179, 0x79, 0x79, 0x67, 0x67, 0x67, 0x67, 0x479, 0x479, 0x479, 0x479, 0x479,
+  0x879, 0x879, 0x879, 0x879, 0x879, 0x879, 0x879, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x175, 0x175, 0x175, 0x175, 0x175, 0x175, 0x175, 0x175, 0x175, 0x175, 0x175, 0x175, 0x175, 0x175, 0x175, 0x175,
+  0x175, 0x175, 0x175, 0x175, 0x175, 0x175, 0x67, 0x67, 0x67, 0x875, 0x875, 0x875, 0x875, 0x875, 0x875, 0x875,
+  0x17d, 0x17d, 0x17d, 0x17d, 0x17d, 0x17d, 0x17d, 0x17d, 0x17d, 0x17d, 0x17d, 0x17d, 0x17d, 0x17d, 0x17d, 0x17d,
+  0x17d, 0x17d, 0x17d, 0x17d, 0x17d, 0x17d, 0x67, 0x67, 0x47d, 0x47d, 0x47d, 0x47d, 0x47d, 0x47d, 0x47d, 0x47d,
+  0x17a, 0x17a, 0x17a, 0x17a, 0x17a, 0x17a, 0x17a, 0x17a, 0x17a, 0x17a, 0x17a, 0x17a, 0x17a, 0x17a, 0x17a, 0x17a,
+  0x17a, 0x17a, 0x17a, 0x67, 0x67, 0x67, 0x67, 0x67, 0x47a, 0x47a, 0x47a, 0x47a, 0x47a, 0x47a, 0x47a, 0x47a,
+  0x17b, 0x17b, 0x17b, 0x17b, 0x17b, 0x17b, 0x17b, 0x17b, 0x17b, 0x17b, 0x17b, 0x17b, 0x17b, 0x17b, 0x17b, 0x17b,
+  0x17b, 0x17b, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x87b, 0x87b, 0x87b, 0x87b, 0x67, 0x67, 0x67,
+  0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x47b, 0x47b, 0x47b, 0x47b, 0x47b, 0x47b, 0x47b,
+  0x158, 0x158, 0x158, 0x158, 0x158, 0x158, 0x158, 0x158, 0x158, 0x158, 0x158, 0x158, 0x158, 0x158, 0x158, 0x158,
+  0x158, 0x158, 0x158, 0x158, 0x158, 0x158, 0x158, 0x158, 0x158, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x14c, 0x14c, 0x14c, 0x14c, 0x14c, 0x14c, 0x14c, 0x14c, 0x14c, 0x14c, 0x14c, 0x14c, 0x14c, 0x14c, 0x14c, 0x14c,
+  0x14c, 0x14c, 0x14c, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x14c, 0x14c, 0x14c, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x44c, 0x44c, 0x44c, 0x44c, 0x44c, 0x44c,
+  0x1b6, 0x1b6, 0x1b6, 0x1b6, 0x1b6, 0x1b6, 0x1b6, 0x1b6, 0x1b6, 0x1b6, 0x1b6, 0x1b6, 0x1b6, 0x1b6, 0x1b6, 0x1b6,
+  0x1b6, 0x1b6, 0x1b6, 0x1b6, 0x1b6, 0x1b6, 0x1b6, 0x1b6, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x6b6, 0x6b6, 0x6b6, 0x6b6, 0x6b6, 0x6b6, 0x6b6, 0x6b6, 0x6b6, 0x6b6, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x402, 0x402, 0x402, 0x402, 0x402, 0x402, 0x402, 0x402, 0x402, 0x402, 0x402, 0x402, 0x402, 0x402, 0x402, 0x402,
+  0x402, 0x402, 0x402, 0x402, 0x402, 0x402, 0x402, 0x402, 0x402, 0x402, 0x402, 0x402, 0x402, 0x402, 0x402, 0x67,
+  0x1c0, 0x1c0, 0x1c0, 0x1c0, 0x1c0, 0x1c0, 0x1c0, 0x1c0, 0x1c0, 0x1c0, 0x1c0, 0x1c0, 0x1c0, 0x1c0, 0x1c0, 0x1c0,
+  0x1c0, 0x1c0, 0x1c0, 0x1c0, 0x1c0, 0x1c0, 0x1c0, 0x1c0, 0x1c0, 0x1c0, 0x67, 0x1c0, 0x1c0, 0x8c0, 0x67, 0x67,
+  0x1c0, 0x1c0, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x2, 0x2, 0x2,
+  0x1b8, 0x1b8, 0x1b8, 0x1b8, 0x1b8, 0x1b8, 0x1b8, 0x1b8, 0x1b8, 0x1b8, 0x1b8, 0x1b8, 0x1b8, 0x1b8, 0x1b8, 0x1b8,
+  0x1b8, 0x1b8, 0x1b8, 0x1b8, 0x1b8, 0x1b8, 0x1b8, 0x1b8, 0x1b8, 0x1b8, 0x1b8, 0x1b8, 0x1b8, 0x4b8, 0x4b8, 0x4b8,
+  0x4b8, 0x4b8, 0x4b8, 0x4b8, 0x4b8, 0x4b8, 0x4b8, 0x1b8, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x1b7, 0x1b7, 0x1b7, 0x1b7, 0x1b7, 0x1b7, 0x1b7, 0x1b7, 0x1b7, 0x1b7, 0x1b7, 0x1b7, 0x1b7, 0x1b7, 0x1b7, 0x1b7,
+  0x1b7, 0x1b7, 0x1b7, 0x1b7, 0x1b7, 0x1b7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
+  0xb7, 0x4b7, 0x4b7, 0x4b7, 0x4b7, 0x8b7, 0x8b7, 0x8b7, 0x8b7, 0x8b7, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x1c2, 0x1c2, 0x1c2, 0x1c2, 0x1c2, 0x1c2, 0x1c2, 0x1c2, 0x1c2, 0x1c2, 0x1c2, 0x1c2, 0x1c2, 0x1c2, 0x1c2, 0x1c2,
+  0x1c2, 0x1c2, 0xc2, 0xc2, 0xc2, 0xc2, 0x8c2, 0x8c2, 0x8c2, 0x8c2, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x1bd, 0x1bd, 0x1bd, 0x1bd, 0x1bd, 0x1bd, 0x1bd, 0x1bd, 0x1bd, 0x1bd, 0x1bd, 0x1bd, 0x1bd, 0x1bd, 0x1bd, 0x1bd,
+  0x1bd, 0x1bd, 0x1bd, 0x1bd, 0x1bd, 0x4bd, 0x4bd, 0x4bd, 0x4bd, 0x4bd, 0x4bd, 0x4bd, 0x67, 0x67, 0x67, 0x67,
+  0x1b9, 0x1b9, 0x1b9, 0x1b9, 0x1b9, 0x1b9, 0x1b9, 0x1b9, 0x1b9, 0x1b9, 0x1b9, 0x1b9, 0x1b9, 0x1b9, 0x1b9, 0x1b9,
+  0x1b9, 0x1b9, 0x1b9, 0x1b9, 0x1b9, 0x1b9, 0x1b9, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x141, 0x141, 0x141, 0x141, 0x141, 0x141, 0x141, 0x141, 0x141, 0x141, 0x141, 0x141, 0x141, 0x141, 0x141, 0x141,
+  0x141, 0x141, 0x141, 0x141, 0x141, 0x141, 0x41, 0x841, 0x841, 0x841, 0x841, 0x841, 0x841, 0x841, 0x67, 0x67,
+  0x67, 0x67, 0x441, 0x441, 0x441, 0x441, 0x441, 0x441, 0x441, 0x441, 0x441, 0x441, 0x441, 0x441, 0x441, 0x441,
+  0x441, 0x441, 0x441, 0x441, 0x441, 0x441, 0x641, 0x641, 0x641, 0x641, 0x641, 0x641, 0x641, 0x641, 0x641, 0x641,
+  0x41, 0x141, 0x141, 0x141, 0x141, 0x141, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x41,
+  0x178, 0x178, 0x178, 0x178, 0x178, 0x178, 0x178, 0x178, 0x178, 0x178, 0x178, 0x178, 0x178, 0x178, 0x178, 0x178,
+  0x178, 0x178, 0x178, 0x178, 0x178, 0x178, 0x178, 0x178, 0x178, 0x78, 0x78, 0x878, 0x878, 0x78, 0x878, 0x878,
+  0x878, 0x878, 0x178, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x78, 0x67, 0x67,
+  0x198, 0x198, 0x198, 0x198, 0x198, 0x198, 0x198, 0x198, 0x198, 0x198, 0x198, 0x198, 0x198, 0x198, 0x198, 0x198,
+  0x198, 0x198, 0x198, 0x198, 0x198, 0x198, 0x198, 0x198, 0x198, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x176, 0x176, 0x176, 0x176, 0x176, 0x176, 0x176, 0x176, 0x176, 0x176, 0x176, 0x176, 0x176, 0x176, 0x176, 0x176,
+  0x176, 0x176, 0x176, 0x76, 0x76, 0x67, 0x676, 0x676, 0x676, 0x676, 0x676, 0x676, 0x676, 0x676, 0x676, 0x676,
+  0x876, 0x876, 0x876, 0x876, 0x176, 0x176, 0x176, 0x176, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x1a0, 0x1a0, 0x1a0, 0x1a0, 0x1a0, 0x1a0, 0x1a0, 0x1a0, 0x1a0, 0x1a0, 0x1a0, 0x1a0, 0x1a0, 0x1a0, 0x1a0, 0x1a0,
+  0x1a0, 0x1a0, 0x1a0, 0xa0, 0x8a0, 0x8a0, 0x1a0, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x197, 0x197, 0x197, 0x197, 0x197, 0x197, 0x197, 0x197, 0x197, 0x197, 0x197, 0x197, 0x197, 0x197, 0x197, 0x197,
+  0x97, 0x197, 0x197, 0x197, 0x197, 0x897, 0x897, 0x897, 0x897, 0x97, 0x97, 0x97, 0x97, 0x897, 0x197, 0x197,
+  0x697, 0x697, 0x697, 0x697, 0x697, 0x697, 0x697, 0x697, 0x697, 0x697, 0x197, 0x897, 0x197, 0x897, 0x897, 0x897,
+  0x67, 0x421, 0x421, 0x421, 0x421, 0x421, 0x421, 0x421, 0x421, 0x421, 0x421, 0x421, 0x421, 0x421, 0x421, 0x421,
+  0x421, 0x421, 0x421, 0x421, 0x421, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x19d, 0x19d, 0x19d, 0x19d, 0x19d, 0x19d, 0x19d, 0x19d, 0x19d, 0x19d, 0x19d, 0x19d, 0x19d, 0x19d, 0x19d, 0x19d,
+  0x19d, 0x19d, 0x67, 0x19d, 0x19d, 0x19d, 0x19d, 0x19d, 0x19d, 0x19d, 0x19d, 0x19d, 0x19d, 0x19d, 0x19d, 0x19d,
+  0x19d, 0x19d, 0x19d, 0x19d, 0x19d, 0x9d, 0x9d, 0x19d, 0x89d, 0x89d, 0x89d, 0x89d, 0x89d, 0x89d, 0x19d, 0x19d,
+  0x19d, 0x19d, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x1a4, 0x1a4, 0x1a4, 0x1a4, 0x1a4, 0x1a4, 0x1a4, 0x67, 0x1a4, 0x67, 0x1a4, 0x1a4, 0x1a4, 0x1a4, 0x67, 0x1a4,
+  0x1a4, 0x1a4, 0x1a4, 0x1a4, 0x1a4, 0x1a4, 0x1a4, 0x1a4, 0x1a4, 0x1a4, 0x1a4, 0x1a4, 0x1a4, 0x1a4, 0x67, 0x1a4,
+  0x1a4, 0x1a4, 0x1a4, 0x1a4, 0x1a4, 0x1a4, 0x1a4, 0x1a4, 0x1a4, 0x8a4, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x191, 0x191, 0x191, 0x191, 0x191, 0x191, 0x191, 0x191, 0x191, 0x191, 0x191, 0x191, 0x191, 0x191, 0x191, 0x191,
+  0x191, 0x191, 0x191, 0x191, 0x191, 0x191, 0x191, 0x191, 0x191, 0x91, 0x91, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x691, 0x691, 0x691, 0x691, 0x691, 0x691, 0x691, 0x691, 0x691, 0x691, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x189, 0x189, 0x189, 0x189, 0x67, 0x189, 0x189, 0x189, 0x189, 0x189, 0x189, 0x189, 0x189, 0x67, 0x67, 0x189,
+  0x189, 0x67, 0x67, 0x189, 0x189, 0x189, 0x189, 0x189, 0x189, 0x189, 0x189, 0x189, 0x189, 0x189, 0x189, 0x189,
+  0x189, 0x189, 0x189, 0x189, 0x189, 0x189, 0x189, 0x189, 0x189, 0x67, 0x189, 0x189, 0x189, 0x189, 0x189, 0x189,
+  0x189, 0x67, 0x189, 0x189, 0x67, 0x189, 0x189, 0x189, 0x189, 0x189, 0x67, 0x1, 0x89, 0x189, 0x189, 0x189,
+  0x189, 0x189, 0x189, 0x189, 0x189, 0x67, 0x67, 0x189, 0x189, 0x67, 0x67, 0x189, 0x189, 0x89, 0x67, 0x67,
+  0x189, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x189, 0x67, 0x67, 0x67, 0x67, 0x67, 0x189, 0x189, 0x189,
+  0x189, 0x189, 0x189, 0x189, 0x67, 0x67, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x67, 0x67, 0x67,
+  0x89, 0x89, 0x89, 0x89, 0x89, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x1aa, 0x1aa, 0x1aa, 0x1aa, 0x1aa, 0x1aa, 0x1aa, 0x1aa, 0x1aa, 0x1aa, 0x1aa, 0x1aa, 0x1aa, 0x1aa, 0x1aa, 0x1aa,
+  0x1aa, 0x1aa, 0xaa, 0x1aa, 0x1aa, 0x1aa, 0xaa, 0x1aa, 0x1aa, 0x1aa, 0x1aa, 0x8aa, 0x8aa, 0x8aa, 0x8aa, 0x8aa,
+  0x6aa, 0x6aa, 0x6aa, 0x6aa, 0x6aa, 0x6aa, 0x6aa, 0x6aa, 0x6aa, 0x6aa, 0x8aa, 0x8aa, 0x67, 0x8aa, 0xaa, 0x1aa,
+  0x1aa, 0x1aa, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x19e, 0x19e, 0x19e, 0x19e, 0x19e, 0x19e, 0x19e, 0x19e, 0x19e, 0x19e, 0x19e, 0x19e, 0x19e, 0x19e, 0x19e, 0x19e,
+  0x19e, 0x19e, 0x9e, 0x9e, 0x19e, 0x19e, 0x89e, 0x19e, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x69e, 0x69e, 0x69e, 0x69e, 0x69e, 0x69e, 0x69e, 0x69e, 0x69e, 0x69e, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x1a6, 0x1a6, 0x1a6, 0x1a6, 0x1a6, 0x1a6, 0x1a6, 0x1a6, 0x1a6, 0x1a6, 0x1a6, 0x1a6, 0x1a6, 0x1a6, 0x1a6, 0x1a6,
+  0x1a6, 0x1a6, 0x1a6, 0x1a6, 0x1a6, 0x1a6, 0x67, 0x67, 0x1a6, 0x1a6, 0x1a6, 0x1a6, 0x1a6, 0x1a6, 0x1a6, 0xa6,
+  0xa6, 0x8a6, 0x8a6, 0x8a6, 0x8a6, 0x8a6, 0x8a6, 0x8a6, 0x8a6, 0x8a6, 0x8a6, 0x8a6, 0x8a6, 0x8a6, 0x8a6, 0x8a6,
+  0x8a6, 0x8a6, 0x8a6, 0x8a6, 0x8a6, 0x8a6, 0x8a6, 0x8a6, 0x1a6, 0x1a6, 0x1a6, 0x1a6, 0x1a6, 0x1a6, 0x67, 0x67,
+  0x1a3, 0x1a3, 0x1a3, 0x1a3, 0x1a3, 0x1a3, 0x1a3, 0x1a3, 0x1a3, 0x1a3, 0x1a3, 0x1a3, 0x1a3, 0x1a3, 0x1a3, 0x1a3,
+  0x1a3, 0x1a3, 0x1a3, 0x1a3, 0x1a3, 0x1a3, 0x1a3, 0x1a3, 0x1a3, 0x1a3, 0x1a3, 0x1a3, 0x1a3, 0x1a3, 0x1a3, 0xa3,
+  0x1a3, 0x8a3, 0x8a3, 0x8a3, 0x1a3, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x6a3, 0x6a3, 0x6a3, 0x6a3, 0x6a3, 0x6a3, 0x6a3, 0x6a3, 0x6a3, 0x6a3, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x81b, 0x81b, 0x81b, 0x81b, 0x81b, 0x81b, 0x81b, 0x81b, 0x81b, 0x81b, 0x81b, 0x81b, 0x81b, 0x67, 0x67, 0x67,
+  0x199, 0x199, 0x199, 0x199, 0x199, 0x199, 0x199, 0x199, 0x199, 0x199, 0x199, 0x199, 0x199, 0x199, 0x199, 0x199,
+  0x199, 0x199, 0x199, 0x199, 0x199, 0x199, 0x99, 0x99, 0x199, 0x899, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x699, 0x699, 0x699, 0x699, 0x699, 0x699, 0x699, 0x699, 0x699, 0x699, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1,
+  0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x67, 0x67, 0x1a1, 0x1a1, 0x1a1,
+  0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0xa1, 0x67, 0x67, 0x67, 0x67,
+  0x6a1, 0x6a1, 0x6a1, 0x6a1, 0x6a1, 0x6a1, 0x6a1, 0x6a1, 0x6a1, 0x6a1, 0x4a1, 0x4a1, 0x8a1, 0x8a1, 0x8a1, 0xa1,
+  0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x1a1, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x1b2, 0x1b2, 0x1b2, 0x1b2, 0x1b2, 0x1b2, 0x1b2, 0x1b2, 0x1b2, 0x1b2, 0x1b2, 0x1b2, 0x1b2, 0x1b2, 0x1b2, 0x1b2,
+  0x1b2, 0x1b2, 0x1b2, 0x1b2, 0x1b2, 0x1b2, 0x1b2, 0x1b2, 0x1b2, 0xb2, 0xb2, 0x8b2, 0x67, 0x67, 0x67, 0x67,
+  0x192, 0x192, 0x192, 0x192, 0x192, 0x192, 0x192, 0x192, 0x192, 0x192, 0x192, 0x192, 0x192, 0x192, 0x192, 0x192,
+  0x692, 0x692, 0x692, 0x692, 0x692, 0x692, 0x692, 0x692, 0x692, 0x692, 0x492, 0x492, 0x492, 0x492, 0x492, 0x492,
+  0x492, 0x492, 0x492, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x192,
+  0x1be, 0x1be, 0x1be, 0x1be, 0x1be, 0x1be, 0x1be, 0x67, 0x67, 0x1be, 0x67, 0x67, 0x1be, 0x1be, 0x1be, 0x1be,
+  0x1be, 0x1be, 0x1be, 0x1be, 0x67, 0x1be, 0x1be, 0x67, 0x1be, 0x1be, 0x1be, 0x1be, 0x1be, 0x1be, 0x1be, 0x1be,
+  0x1be, 0x1be, 0x1be, 0x1be, 0x1be, 0x1be, 0x1be, 0x1be, 0x1be, 0x1be, 0x1be, 0x1be, 0x1be, 0x1be, 0x1be, 0x1be,
+  0x1be, 0x1be, 0x1be, 0x1be, 0x1be, 0x1be, 0x67, 0x1be, 0x1be, 0x67, 0x67, 0x1be, 0x1be, 0xbe, 0xbe, 0x1be,
+  0x1be, 0x1be, 0x1be, 0xbe, 0x8be, 0x8be, 0x8be, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x6be, 0x6be, 0x6be, 0x6be, 0x6be, 0x6be, 0x6be, 0x6be, 0x6be, 0x6be, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x1bb, 0x1bb, 0x1bb, 0x1bb, 0x1bb, 0x1bb, 0x1bb, 0x1bb, 0x67, 0x67, 0x1bb, 0x1bb, 0x1bb, 0x1bb, 0x1bb, 0x1bb,
+  0x1bb, 0x1bb, 0x1bb, 0x1bb, 0x1bb, 0x1bb, 0x1bb, 0x1bb, 0x1bb, 0x1bb, 0x1bb, 0x1bb, 0x1bb, 0x1bb, 0x1bb, 0x1bb,
+  0xbb, 0x1bb, 0x8bb, 0x1bb, 0x1bb, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+  0x1b1, 0x1b1, 0x1b1, 0xb1, 0xb1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x8b1,
+  0x8b1, 0x8b1, 0x8b1, 0x8b1, 0x8b1, 0x8b1, 0x8b1, 0xb1, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x1b0, 0x1b0, 0x1b0, 0x1b0, 0x1b0, 0x1b0, 0x1b0, 0x1b0, 0x1b0, 0x1b0, 0x1b0, 0x1b0, 0x1b0, 0x1b0, 0x1b0, 0x1b0,
+  0x1b0, 0x1b0, 0x1b0, 0x1b0, 0x1b0, 0x1b0, 0x1b0, 0x1b0, 0xb0, 0xb0, 0x8b0, 0x8b0, 0x8b0, 0x1b0, 0x8b0, 0x8b0,
+  0x8b0, 0x8b0, 0x8b0, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x1a5, 0x1a5, 0x1a5, 0x1a5, 0x1a5, 0x1a5, 0x1a5, 0x1a5, 0x1a5, 0x1a5, 0x1a5, 0x1a5, 0x1a5, 0x1a5, 0x1a5, 0x1a5,
+  0x1a5, 0x1a5, 0x1a5, 0x1a5, 0x1a5, 0x1a5, 0x1a5, 0x1a5, 0x1a5, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x80a, 0x80a, 0x80a, 0x80a, 0x80a, 0x80a, 0x80a, 0x80a, 0x80a, 0x80a, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x67, 0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x1a8,
+  0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x1a8,
+  0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x67, 0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x1a8, 0x1a8, 0xa8,
+  0x1a8, 0x8a8, 0x8a8, 0x8a8, 0x8a8, 0x8a8, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x6a8, 0x6a8, 0x6a8, 0x6a8, 0x6a8, 0x6a8, 0x6a8, 0x6a8, 0x6a8, 0x6a8, 0x4a8, 0x4a8, 0x4a8, 0x4a8, 0x4a8, 0x4a8,
+  0x4a8, 0x4a8, 0x4a8, 0x4a8, 0x4a8, 0x4a8, 0x4a8, 0x4a8, 0x4a8, 0x4a8, 0x4a8, 0x4a8, 0x4a8, 0x67, 0x67, 0x67,
+  0x8a9, 0x8a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9,
+  0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9,
+  0x67, 0x67, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9,
+  0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x67, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9,
+  0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x1a9, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x1af, 0x1af, 0x1af, 0x1af, 0x1af, 0x1af, 0x1af, 0x67, 0x1af, 0x1af, 0x67, 0x1af, 0x1af, 0x1af, 0x1af, 0x1af,
+  0x1af, 0x1af, 0x1af, 0x1af, 0x1af, 0x1af, 0x1af, 0x1af, 0x1af, 0x1af, 0x1af, 0x1af, 0x1af, 0x1af, 0x1af, 0x1af,
+  0x1af, 0x1af, 0x1af, 0x1af, 0x1af, 0x1af, 0x1af, 0x67, 0x67, 0x67, 0x1af, 0x67, 0x1af, 0x1af, 0x67, 0x1af,
+  0x1af, 0x1af, 0xaf, 0x1af, 0xaf, 0xaf, 0x1af, 0x1af, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x6af, 0x6af, 0x6af, 0x6af, 0x6af, 0x6af, 0x6af, 0x6af, 0x6af, 0x6af, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x67, 0x1b3, 0x1b3, 0x67, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3,
+  0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3,
+  0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0x67,
+  0x1b3, 0x1b3, 0x67, 0x1b3, 0x1b3, 0x1b3, 0x1b3, 0xb3, 0x1b3, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x6b3, 0x6b3, 0x6b3, 0x6b3, 0x6b3, 0x6b3, 0x6b3, 0x6b3, 0x6b3, 0x6b3, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x1b4, 0x1b4, 0x1b4, 0x1b4, 0x1b4, 0x1b4, 0x1b4, 0x1b4, 0x1b4, 0x1b4, 0x1b4, 0x1b4, 0x1b4, 0x1b4, 0x1b4, 0x1b4,
+  0x1b4, 0x1b4, 0x1b4, 0x1b4, 0x1b4, 0x1b4, 0x1b4, 0x8b4, 0x8b4, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6,
+  0x1c6, 0x67, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6,
+  0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x1c6, 0x67, 0x67, 0x67, 0x1c6, 0x1c6,
+  0x1c6, 0xc6, 0xc6, 0x8c6, 0x8c6, 0x8c6, 0x8c6, 0x8c6, 0x8c6, 0x8c6, 0x8c6, 0x8c6, 0x8c6, 0x8c6, 0x8c6, 0x8c6,
+  0x6c6, 0x6c6, 0x6c6, 0x6c6, 0x6c6, 0x6c6, 0x6c6, 0x6c6, 0x6c6, 0x6c6, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x183, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x423, 0x423, 0x423, 0x423, 0x423, 0x423, 0x423, 0x423, 0x423, 0x423, 0x423, 0x423, 0x423, 0x423, 0x423, 0x423,
+  0x423, 0x423, 0x423, 0x423, 0x423, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x823,
+  0x165, 0x165, 0x165, 0x165, 0x165, 0x165, 0x165, 0x165, 0x165, 0x165, 0x165, 0x165, 0x165, 0x165, 0x165, 0x165,
+  0x165, 0x165, 0x165, 0x165, 0x165, 0x165, 0x165, 0x165, 0x165, 0x165, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x565, 0x565, 0x565, 0x565, 0x565, 0x565, 0x565, 0x565, 0x565, 0x565, 0x565, 0x565, 0x565, 0x565, 0x565, 0x565,
+  0x565, 0x565, 0x565, 0x565, 0x565, 0x565, 0x565, 0x565, 0x565, 0x565, 0x565, 0x565, 0x565, 0x565, 0x565, 0x67,
+  0x865, 0x865, 0x865, 0x865, 0x865, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x165, 0x165, 0x165, 0x165, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x1c1, 0x1c1, 0x1c1, 0x1c1, 0x1c1, 0x1c1, 0x1c1, 0x1c1, 0x1c1, 0x1c1, 0x1c1, 0x1c1, 0x1c1, 0x1c1, 0x1c1, 0x1c1,
+  0x1c1, 0x8c1, 0x8c1, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x147, 0x147, 0x147, 0x147, 0x147, 0x147, 0x147, 0x147, 0x147, 0x147, 0x147, 0x147, 0x147, 0x147, 0x147, 0x147,
+  0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
+  0x47, 0x147, 0x147, 0x147, 0x147, 0x147, 0x147, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
+  0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x19c, 0x19c, 0x19c, 0x19c, 0x19c, 0x19c, 0x19c, 0x19c, 0x19c, 0x19c, 0x19c, 0x19c, 0x19c, 0x19c, 0x19c, 0x19c,
+  0x19c, 0x19c, 0x19c, 0x19c, 0x19c, 0x19c, 0x19c, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x182, 0x182, 0x182, 0x182, 0x182, 0x182, 0x182, 0x182, 0x182, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195,
+  0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x67,
+  0x695, 0x695, 0x695, 0x695, 0x695, 0x695, 0x695, 0x695, 0x695, 0x695, 0x67, 0x67, 0x67, 0x67, 0x895, 0x895,
+  0x1c3, 0x1c3, 0x1c3, 0x1c3, 0x1c3, 0x1c3, 0x1c3, 0x1c3, 0x1c3, 0x1c3, 0x1c3, 0x1c3, 0x1c3, 0x1c3, 0x1c3, 0x1c3,
+  0x1c3, 0x1c3, 0x1c3, 0x1c3, 0x1c3, 0x1c3, 0x1c3, 0x1c3, 0x1c3, 0x1c3, 0x1c3, 0x1c3, 0x1c3, 0x1c3, 0x1c3, 0x67,
+  0x6c3, 0x6c3, 0x6c3, 0x6c3, 0x6c3, 0x6c3, 0x6c3, 0x6c3, 0x6c3, 0x6c3, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186,
+  0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x67, 0x67,
+  0x86, 0x86, 0x86, 0x86, 0x86, 0x886, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x14b, 0x14b, 0x14b, 0x14b, 0x14b, 0x14b, 0x14b, 0x14b, 0x14b, 0x14b, 0x14b, 0x14b, 0x14b, 0x14b, 0x14b, 0x14b,
+  0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x84b, 0x84b, 0x84b, 0x84b, 0x84b, 0x4b, 0x4b, 0x4b, 0x4b,
+  0x14b, 0x14b, 0x14b, 0x14b, 0x84b, 0x4b, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x64b, 0x64b, 0x64b, 0x64b, 0x64b, 0x64b, 0x64b, 0x64b, 0x64b, 0x64b, 0x67, 0x44b, 0x44b, 0x44b, 0x44b, 0x44b,
+  0x44b, 0x44b, 0x67, 0x14b, 0x14b, 0x14b, 0x14b, 0x14b, 0x14b, 0x14b, 0x14b, 0x14b, 0x14b, 0x14b, 0x14b, 0x14b,
+  0x14b, 0x14b, 0x14b, 0x14b, 0x14b, 0x14b, 0x14b, 0x14b, 0x67, 0x67, 0x67, 0x67, 0x67, 0x14b, 0x14b, 0x14b,
+  0x1b5, 0x1b5, 0x1b5, 0x1b5, 0x1b5, 0x1b5, 0x1b5, 0x1b5, 0x1b5, 0x1b5, 0x1b5, 0x1b5, 0x1b5, 0x1b5, 0x1b5, 0x1b5,
+  0x4b5, 0x4b5, 0x4b5, 0x4b5, 0x4b5, 0x4b5, 0x4b5, 0x4b5, 0x4b5, 0x4b5, 0x4b5, 0x4b5, 0x4b5, 0x4b5, 0x4b5, 0x4b5,
+  0x4b5, 0x4b5, 0x4b5, 0x4b5, 0x4b5, 0x4b5, 0x4b5, 0x8b5, 0x8b5, 0x8b5, 0x8b5, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x15c, 0x15c, 0x15c, 0x15c, 0x15c, 0x15c, 0x15c, 0x15c, 0x15c, 0x15c, 0x15c, 0x15c, 0x15c, 0x15c, 0x15c, 0x15c,
+  0x15c, 0x15c, 0x15c, 0x15c, 0x15c, 0x15c, 0x15c, 0x15c, 0x15c, 0x15c, 0x15c, 0x67, 0x67, 0x67, 0x67, 0x15c,
+  0x15c, 0x15c, 0x15c, 0x15c, 0x15c, 0x15c, 0x15c, 0x15c, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x15c,
+  0x19a, 0x196, 0x811, 0x111, 0xbf, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x111, 0x111, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x19a, 0x19a, 0x19a, 0x19a, 0x19a, 0x19a, 0x19a, 0x19a, 0x19a, 0x19a, 0x19a, 0x19a, 0x19a, 0x19a, 0x19a, 0x19a,
+  0x19a, 0x19a, 0x19a, 0x19a, 0x19a, 0x19a, 0x19a, 0x19a, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x1bf, 0x1bf, 0x1bf, 0x1bf, 0x1bf, 0x1bf, 0x1bf, 0x1bf, 0x1bf, 0x1bf, 0x1bf, 0x1bf, 0x1bf, 0x1bf, 0x1bf, 0x1bf,
+  0x1bf, 0x1bf, 0x1bf, 0x1bf, 0x1bf, 0x1bf, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x19a, 0x19a, 0x19a, 0x19a, 0x19a, 0x19a, 0x19a, 0x19a, 0x19a, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x116, 0x116, 0x116, 0x116, 0x67, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x67, 0x116, 0x116, 0x67,
+  0x116, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114,
+  0x116, 0x116, 0x116, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x67, 0x67, 0x114, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x114, 0x114, 0x114, 0x67, 0x67, 0x116, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x67, 0x67, 0x67, 0x67, 0x116, 0x116, 0x116, 0x116, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x196, 0x196, 0x196, 0x196, 0x196, 0x196, 0x196, 0x196, 0x196, 0x196, 0x196, 0x196, 0x196, 0x196, 0x196, 0x196,
+  0x196, 0x196, 0x196, 0x196, 0x196, 0x196, 0x196, 0x196, 0x196, 0x196, 0x196, 0x196, 0x67, 0x67, 0x67, 0x67,
+  0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187,
+  0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x67, 0x67, 0x67,
+  0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x187, 0x67, 0x67, 0x87, 0x87, 0x187, 0x887,
+  0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x67, 0x67,
+  0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x67, 0x67, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+  0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0,
+  0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe,
+  0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x400, 0x400, 0x400, 0x400, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x100, 0x100, 0x100, 0x100, 0x100, 0x67, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+  0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x67, 0x100, 0x100,
+  0x67, 0x67, 0x100, 0x67, 0x67, 0x100, 0x100, 0x67, 0x67, 0x100, 0x100, 0x100, 0x100, 0x67, 0x100, 0x100,
+  0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x67, 0x100, 0x67, 0x100, 0x100, 0x100,
+  0x100, 0x100, 0x100, 0x100, 0x67, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+  0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x67, 0x100, 0x100, 0x100, 0x100, 0x67, 0x67, 0x100, 0x100, 0x100,
+  0x100, 0x100, 0x100, 0x100, 0x100, 0x67, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x67, 0x100, 0x100,
+  0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x67, 0x100, 0x100, 0x100, 0x100, 0x67,
+  0x100, 0x100, 0x100, 0x100, 0x100, 0x67, 0x100, 0x67, 0x67, 0x67, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+  0x100, 0x67, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+  0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x67, 0x67, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+  0x100, 0x0, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+  0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x0, 0x100, 0x100, 0x100, 0x100,
+  0x100, 0x100, 0x100, 0x100, 0x100, 0x0, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+  0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x0,
+  0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x0, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+  0x100, 0x100, 0x100, 0x0, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x67, 0x67, 0x600, 0x600,
+  0x600, 0x600, 0x600, 0x600, 0x600, 0x600, 0x600, 0x600, 0x600, 0x600, 0x600, 0x600, 0x600, 0x600, 0x600, 0x600,
+  0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+  0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x870, 0x870, 0x870, 0x870, 0x870, 0x67, 0x67, 0x67, 0x67,
+  0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x70, 0x70, 0x70, 0x70, 0x70,
+  0x67, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+  0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x67,
+  0x67, 0x67, 0x67, 0x67, 0x67, 0x119, 0x119, 0x119, 0x119, 0x119, 0x119, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x138, 0x138, 0x138, 0x138, 0x138, 0x138, 0x138, 0x67, 0x138, 0x138, 0x138, 0x138, 0x138, 0x138, 0x138, 0x138,
+  0x138, 0x138, 0x138, 0x138, 0x138, 0x138, 0x138, 0x138, 0x138, 0x67, 0x67, 0x138, 0x138, 0x138, 0x138, 0x138,
+  0x138, 0x138, 0x67, 0x138, 0x138, 0x67, 0x138, 0x138, 0x138, 0x138, 0x138, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x108, 0x67, 0x67,
+  0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x108,
+  0x1ba, 0x1ba, 0x1ba, 0x1ba, 0x1ba, 0x1ba, 0x1ba, 0x1ba, 0x1ba, 0x1ba, 0x1ba, 0x1ba, 0x1ba, 0x1ba, 0x1ba, 0x1ba,
+  0x1ba, 0x1ba, 0x1ba, 0x1ba, 0x1ba, 0x1ba, 0x1ba, 0x1ba, 0x1ba, 0x1ba, 0x1ba, 0x1ba, 0x1ba, 0x67, 0x67, 0x67,
+  0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0x1ba, 0x1ba, 0x1ba, 0x1ba, 0x1ba, 0x1ba, 0x1ba, 0x67, 0x67,
+  0x6ba, 0x6ba, 0x6ba, 0x6ba, 0x6ba, 0x6ba, 0x6ba, 0x6ba, 0x6ba, 0x6ba, 0x67, 0x67, 0x67, 0x67, 0x1ba, 0xba,
+  0x1c4, 0x1c4, 0x1c4, 0x1c4, 0x1c4, 0x1c4, 0x1c4, 0x1c4, 0x1c4, 0x1c4, 0x1c4, 0x1c4, 0x1c4, 0x1c4, 0x1c4, 0x1c4,
+  0x1c4, 0x1c4, 0x1c4, 0x1c4, 0x1c4, 0x1c4, 0x1c4, 0x1c4, 0x1c4, 0x1c4, 0x1c4, 0x1c4, 0x1c4, 0x1c4, 0xc4, 0x67,
+  0x1bc, 0x1bc, 0x1bc, 0x1bc, 0x1bc, 0x1bc, 0x1bc, 0x1bc, 0x1bc, 0x1bc, 0x1bc, 0x1bc, 0x1bc, 0x1bc, 0x1bc, 0x1bc,
+  0x1bc, 0x1bc, 0x1bc, 0x1bc, 0x1bc, 0x1bc, 0x1bc, 0x1bc, 0x1bc, 0x1bc, 0x1bc, 0x1bc, 0xbc, 0xbc, 0xbc, 0xbc,
+  0x6bc, 0x6bc, 0x6bc, 0x6bc, 0x6bc, 0x6bc, 0x6bc, 0x6bc, 0x6bc, 0x6bc, 0x67, 0x67, 0x67, 0x67, 0x67, 0xbc,
+  0x1c7, 0x1c7, 0x1c7, 0x1c7, 0x1c7, 0x1c7, 0x1c7, 0x1c7, 0x1c7, 0x1c7, 0x1c7, 0x1c7, 0x1c7, 0x1c7, 0x1c7, 0x1c7,
+  0x1c7, 0x1c7, 0x1c7, 0x1c7, 0x1c7, 0x1c7, 0x1c7, 0x1c7, 0x1c7, 0x1c7, 0x1c7, 0x1c7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0x6c7, 0x6c7, 0x6c7, 0x6c7, 0x6c7, 0x6c7, 0x6c7, 0x6c7, 0x6c7, 0x6c7, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x67, 0x10b, 0x10b, 0x10b, 0x10b, 0x67, 0x10b, 0x10b, 0x67,
+  0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x10b, 0x67,
+  0x18c, 0x18c, 0x18c, 0x18c, 0x18c, 0x18c, 0x18c, 0x18c, 0x18c, 0x18c, 0x18c, 0x18c, 0x18c, 0x18c, 0x18c, 0x18c,
+  0x18c, 0x18c, 0x18c, 0x18c, 0x18c, 0x67, 0x67, 0x48c, 0x48c, 0x48c, 0x48c, 0x48c, 0x48c, 0x48c, 0x48c, 0x48c,
+  0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x1a7, 0x1a7, 0x1a7, 0x1a7, 0x1a7, 0x1a7, 0x1a7, 0x1a7, 0x1a7, 0x1a7, 0x1a7, 0x1a7, 0x1a7, 0x1a7, 0x1a7, 0x1a7,
+  0x1a7, 0x1a7, 0x1a7, 0x1a7, 0xa7, 0xa7, 0xa7, 0x1a7, 0xa7, 0xa7, 0xa7, 0x1a7, 0x67, 0x67, 0x67, 0x67,
+  0x6a7, 0x6a7, 0x6a7, 0x6a7, 0x6a7, 0x6a7, 0x6a7, 0x6a7, 0x6a7, 0x6a7, 0x67, 0x67, 0x67, 0x67, 0x8a7, 0x8a7,
+  0x67, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400,
+  0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x0, 0x400, 0x400, 0x400,
+  0x0, 0x400, 0x400, 0x400, 0x400, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x0, 0x400,
+  0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x67, 0x67,
+  0x102, 0x102, 0x102, 0x102, 0x67, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102,
+  0x67, 0x102, 0x102, 0x67, 0x102, 0x67, 0x67, 0x102, 0x67, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102,
+  0x102, 0x102, 0x102, 0x67, 0x102, 0x102, 0x102, 0x102, 0x67, 0x102, 0x67, 0x102, 0x67, 0x67, 0x67, 0x67,
+  0x67, 0x67, 0x102, 0x67, 0x67, 0x67, 0x67, 0x102, 0x67, 0x102, 0x67, 0x102, 0x67, 0x102, 0x102, 0x102,
+  0x67, 0x102, 0x102, 0x67, 0x102, 0x67, 0x67, 0x102, 0x67, 0x102, 0x67, 0x102, 0x67, 0x102, 0x67, 0x102,
+  0x67, 0x102, 0x102, 0x67, 0x102, 0x67, 0x67, 0x102, 0x102, 0x102, 0x102, 0x67, 0x102, 0x102, 0x102, 0x102,
+  0x102, 0x102, 0x102, 0x67, 0x102, 0x102, 0x102, 0x102, 0x67, 0x102, 0x102, 0x102, 0x102, 0x67, 0x102, 0x67,
+  0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x67, 0x102, 0x102, 0x102, 0x102, 0x102,
+  0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x102, 0x67, 0x67, 0x67, 0x67,
+  0x67, 0x102, 0x102, 0x102, 0x67, 0x102, 0x102, 0x102, 0x102, 0x102, 0x67, 0x102, 0x102, 0x102, 0x102, 0x102,
+  0x2, 0x2, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x67,
+  0x67, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x0, 0x0, 0x0,
+  0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x67, 0x67,
+  0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x14, 0x0, 0x0, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x0, 0x0, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x67, 0x67, 0x67, 0x67, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x67, 0x67, 0x67, 0x67, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x67, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x67, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x600, 0x600, 0x600, 0x600, 0x600, 0x600, 0x600, 0x600, 0x600, 0x600, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x111, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x67, 0x67, 0x67, 0x67, 0x67,
+  0x67, 0x0, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+};
+
+} // namespace tables
+} // namespace utf8
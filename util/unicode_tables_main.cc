@@ -0,0 +1,104 @@
+// Writes util/unicode_tables.hh from the ICU this is linked against:
+//   bin/unicode_tables >../util/unicode_tables.hh
+// Each code point's flags and script go in a 16-bit value.  The values are
+// looked up in three stages: the top bits of a code point pick a row of
+// stage 2, which picks a block of stage 3, and identical rows and blocks are
+// stored once.
+#include "util/unicode_properties.hh"
+
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <vector>
+
+#include <stdint.h>
+#include <unicode/uchar.h>
+#include <unicode/uscript.h>
+#include <unicode/uversion.h>
+
+namespace {
+
+const UChar32 kEnd = 0x110000;
+
+uint16_t Value(UChar32 character) {
+  uint8_t flags = 0;
+  if (u_hasBinaryProperty(character, UCHAR_ALPHABETIC)) flags |= utf8::kAlpha;
+  if (u_isdigit(character)) flags |= utf8::kDigit;
+  if (U_GET_GC_MASK(character) & U_GC_N_MASK) flags |= utf8::kNumber;
+  if (u_ispunct(character)) flags |= utf8::kPunct;
+  if (u_hasBinaryProperty(character, UCHAR_WHITE_SPACE)) flags |= utf8::kSpace;
+  UErrorCode err = U_ZERO_ERROR;
+  UScriptCode script = uscript_getScript(character, &err);
+  // 0xFF is for what isn't a code point.
+  if (U_FAILURE(err) || script < 0 || script >= 0xFF) {
+    std::cerr << "Script of U+" << std::hex << character << " does not fit in a byte." << std::endl;
+    exit(1);
+  }
+  return static_cast<uint16_t>(flags << 8 | script);
+}
+
+// Splits values into blocks of size, storing each distinct block once.
+// Returns the index of each block in out, counted in blocks.
+template <class Value> std::vector<unsigned> Dedupe(const std::vector<Value> &values, std::size_t size, std::vector<Value> &out) {
+  std::map<std::vector<Value>, unsigned> seen;
+  std::vector<unsigned> index;
+  for (std::size_t i = 0; i < values.size(); i += size) {
+    std::vector<Value> block(values.begin() + i, values.begin() + i + size);
+    typename std::map<std::vector<Value>, unsigned>::iterator found = seen.find(block);
+    if (found == seen.end()) {
+      found = seen.insert(std::make_pair(block, static_cast<unsigned>(seen.size()))).first;
+      out.insert(out.end(), block.begin(), block.end());
+    }
+    index.push_back(found->second);
+  }
+  return index;
+}
+
+template <class Value> void WriteArray(const char *type, const char *name, const std::vector<Value> &values) {
+  std::cout << "extern const " << type << ' ' << name << "[" << std::dec << values.size() << "] = {";
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    std::cout << (i % 16 ? " " : "\n  ") << "0x" << std::hex << static_cast<unsigned>(values[i]) << ',';
+  }
+  std::cout << "\n};\n\n";
+}
+
+} // namespace
+
+int main() {
+  using utf8::tables::kShift2;
+  using utf8::tables::kShift3;
+  std::vector<uint16_t> values(kEnd);
+  for (UChar32 c = 0; c < kEnd; ++c) {
+    values[c] = Value(c);
+  }
+  std::vector<uint16_t> stage3;
+  std::vector<unsigned> blocks(Dedupe(values, 1 << kShift3, stage3));
+  std::vector<uint16_t> stage2;
+  std::vector<unsigned> rows(Dedupe(std::vector<uint16_t>(blocks.begin(), blocks.end()), 1 << (kShift2 - kShift3), stage2));
+  std::vector<uint8_t> stage1(rows.begin(), rows.end());
+  if (stage2.size() / (1 << (kShift2 - kShift3)) > 0x100 || stage3.size() / (1 << kShift3) > 0x10000) {
+    std::cerr << "Too many distinct blocks for the stage types." << std::endl;
+    return 1;
+  }
+
+  UVersionInfo unicode;
+  u_getUnicodeVersion(unicode);
+  char version[U_MAX_VERSION_STRING_LENGTH];
+  u_versionToString(unicode, version);
+  std::cout <<
+    "/* Generated by util/unicode_tables_main.cc from ICU " U_ICU_VERSION ".  Do not edit.\n"
+    " * Only util/unicode_properties.cc includes this.\n"
+    " */\n\n"
+    "#include <stdint.h>\n\n"
+    "namespace utf8 {\n"
+    "namespace tables {\n\n"
+    "extern const char kUnicodeVersion[] = \"" << version << "\";\n\n";
+  WriteArray("uint8_t", "kStage1", stage1);
+  WriteArray("uint16_t", "kStage2", stage2);
+  WriteArray("uint16_t", "kStage3", stage3);
+  std::cout <<
+    "} // namespace tables\n"
+    "} // namespace utf8\n";
+  std::cerr << "Stage 1 " << stage1.size() << " bytes, stage 2 " << stage2.size() * 2 << " bytes, stage 3 " << stage3.size() * 2 << " bytes." << std::endl;
+  return 0;
+}
@@ -1,27 +1,45 @@
 #include "util/utf8.hh"
 
+#include "util/have.hh"
 #include "util/scoped.hh"
 #include "util/string_piece.hh"
 #include "util/string_piece_hash.hh"
+#include "util/unicode_properties.hh"
 
 #include <boost/scoped_array.hpp>
 #include <boost/scoped_ptr.hpp>
 #include <boost/thread/once.hpp>
+#include <boost/thread/tss.hpp>
 #include <boost/unordered_map.hpp>
 #include <boost/utility.hpp>
 
-#include <unicode/normlzr.h>
+#include <unicode/bytestream.h>
+#include <unicode/normalizer2.h>
 #include <unicode/ucasemap.h>
 #include <unicode/uchar.h>
 #include <unicode/unistr.h>
+#include <unicode/ustring.h>
 #include <unicode/utf8.h>
 #include <unicode/utypes.h>
 
+#include <algorithm>
 #include <iostream>
+#include <map>
 #include <string>
 #include <vector>
 
 #include <err.h>
+#include <stdint.h>
+#include <string.h>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define UTIL_UTF8_AVX2
+#endif
+
+#ifdef HAVE_SSE2
+#include <emmintrin.h>
+#endif
 
 namespace utf8 {
 
@@ -46,15 +64,220 @@ NormalizeException::NormalizeException(const UnicodeString &original, UErrorCode
   what_.append(u_errorName(code));
 }
 
-bool IsUTF8(const StringPiece &str) {
-  int32_t offset = 0;
-  int32_t length = static_cast<uint32_t>(str.size());
-  while (offset < length) {
-    UChar32 character;
-    U8_NEXT(str.data(), offset, (int32_t)str.size(), character);
-    if (character < 0) return false;
+namespace {
+
+// Returns the end of the sequence that starts with a lead byte >= 0x80, or
+// NULL if it is not well-formed (Unicode Table 3-7, which is what U8_NEXT
+// accepts).
+inline const uint8_t *SkipMultibyte(const uint8_t *p, const uint8_t *end) {
+  const uint8_t lead = *p;
+  // Range allowed for the second byte.
+  uint8_t low = 0x80, high = 0xBF;
+  std::size_t trail;
+  if (lead < 0xC2) {
+    return NULL;
+  } else if (lead < 0xE0) {
+    trail = 1;
+  } else if (lead < 0xF0) {
+    trail = 2;
+    // Overlong and surrogates.
+    if (lead == 0xE0) low = 0xA0;
+    if (lead == 0xED) high = 0x9F;
+  } else if (lead < 0xF5) {
+    trail = 3;
+    // Overlong and past U+10FFFF.
+    if (lead == 0xF0) low = 0x90;
+    if (lead == 0xF4) high = 0x8F;
+  } else {
+    return NULL;
   }
-  return true;
+  if (static_cast<std::size_t>(end - p) <= trail) return NULL;
+  if (p[1] < low || p[1] > high) return NULL;
+  for (std::size_t i = 2; i <= trail; ++i) {
+    if ((p[i] & 0xC0) != 0x80) return NULL;
+  }
+  return p + trail + 1;
+}
+
+inline uint64_t Load8(const uint8_t *p) {
+  uint64_t ret;
+  memcpy(&ret, p, 8);
+  return ret;
+}
+
+const uint64_t kHighBits = 0x8080808080808080ULL;
+
+inline bool ValidatePortable(const uint8_t *p, const uint8_t *end) {
+  while (true) {
+    // Skip ASCII 16 bytes at a time, then 8.
+    while (end - p >= 16 && !((Load8(p) | Load8(p + 8)) & kHighBits)) p += 16;
+    if (end - p >= 8 && !(Load8(p) & kHighBits)) p += 8;
+    if (p == end) return true;
+    if (*p < 0x80) {
+      ++p;
+    } else if (!(p = SkipMultibyte(p, end))) {
+      return false;
+    }
+  }
+}
+
+#ifdef UTIL_UTF8_AVX2
+/* The lookup algorithm of Keiser and Lemire, "Validating UTF-8 In Less Than
+ * One Instruction Per Byte" (2021).  Each byte is classified by three 16-entry
+ * tables: the high and low nibbles of the byte before it and its own high
+ * nibble.  A bit survives the AND of the three lookups only if that pair of
+ * bytes is an error.  Third and fourth bytes of a sequence are checked
+ * separately by looking back two and three bytes.
+ */
+const uint8_t kTooShort = 1 << 0; // 11______ 0_______ or 11______ 11______
+const uint8_t kTooLong = 1 << 1; // 0_______ 10______
+const uint8_t kOverlong3 = 1 << 2; // 11100000 100_____
+const uint8_t kTooLarge = 1 << 3; // 11110100 1001____ and up
+const uint8_t kSurrogate = 1 << 4; // 11101101 101_____
+const uint8_t kOverlong2 = 1 << 5; // 1100000_ 10______
+const uint8_t kTooLarge1000 = 1 << 6; // 11110101 1000____ and up
+const uint8_t kOverlong4 = 1 << 6; // 11110000 1000____
+const uint8_t kTwoConts = 1 << 7; // 10______ 10______
+// Errors that only depend on the high nibble of the first byte.
+const uint8_t kCarry = kTooShort | kTooLong | kTwoConts;
+
+#define UTIL_UTF8_TABLE(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p) _mm256_setr_epi8( \
+    a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p, \
+    a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p)
+
+// The bytes N before each byte of input, reaching into the previous block.
+template <int N> __attribute__((target("avx2"))) inline __m256i Prev(__m256i input, __m256i prev_input) {
+  return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev_input, input, 0x21), 16 - N);
+}
+
+__attribute__((target("avx2"))) inline __m256i HighNibble(__m256i v) {
+  return _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0F));
+}
+
+// Nonzero bytes where input is not well-formed given the block before it.
+__attribute__((target("avx2"))) inline __m256i CheckBlockAVX2(__m256i input, __m256i prev_input) {
+  const __m256i prev1 = Prev<1>(input, prev_input);
+  const __m256i byte_1_high = _mm256_shuffle_epi8(UTIL_UTF8_TABLE(
+      // 0_______ ________
+      kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong,
+      // 10______ ________
+      kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+      // 1100____ ________
+      kTooShort | kOverlong2,
+      // 1101____ ________
+      kTooShort,
+      // 1110____ ________
+      kTooShort | kOverlong3 | kSurrogate,
+      // 1111____ ________
+      kTooShort | kTooLarge | kTooLarge1000 | kOverlong4), HighNibble(prev1));
+  const __m256i byte_1_low = _mm256_shuffle_epi8(UTIL_UTF8_TABLE(
+      // ____0000 ________
+      kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+      // ____0001 ________
+      kCarry | kOverlong2,
+      // ____001_ ________
+      kCarry, kCarry,
+      // ____0100 ________
+      kCarry | kTooLarge,
+      // ____0101 ________ and up
+      kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+      kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+      kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+      // ____1101 ________
+      kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+      kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000),
+    _mm256_and_si256(prev1, _mm256_set1_epi8(0x0F)));
+  const __m256i byte_2_high = _mm256_shuffle_epi8(UTIL_UTF8_TABLE(
+      // ________ 0_______
+      kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort,
+      // ________ 1000____
+      kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 | kOverlong4,
+      // ________ 1001____
+      kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+      // ________ 101_____
+      kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+      kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+      // ________ 11______
+      kTooShort, kTooShort, kTooShort, kTooShort), HighNibble(input));
+  const __m256i special = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+  // Bytes two after a 3 or 4 byte lead or three after a 4 byte lead must be
+  // continuations.  These, and only these, are allowed kTwoConts.
+  const __m256i third = _mm256_subs_epu8(Prev<2>(input, prev_input), _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+  const __m256i fourth = _mm256_subs_epu8(Prev<3>(input, prev_input), _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+  const __m256i must_continue = _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8(static_cast<char>(0x80)));
+  return _mm256_xor_si256(must_continue, special);
+}
+
+#undef UTIL_UTF8_TABLE
+
+__attribute__((target("avx2"))) bool ValidateAVX2(const uint8_t *p, const uint8_t *end) {
+  // Nonzero where the block ends in the middle of a sequence.
+  const __m256i incomplete_max = _mm256_setr_epi8(
+      -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+      -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+      static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+  __m256i error = _mm256_setzero_si256();
+  __m256i prev_input = _mm256_setzero_si256();
+  __m256i prev_incomplete = _mm256_setzero_si256();
+  for (; end - p >= 32; p += 32) {
+    const __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    if (!_mm256_movemask_epi8(input)) {
+      // ASCII only needs the previous block to have been complete.
+      error = _mm256_or_si256(error, prev_incomplete);
+      prev_incomplete = _mm256_setzero_si256();
+    } else {
+      error = _mm256_or_si256(error, CheckBlockAVX2(input, prev_input));
+      prev_incomplete = _mm256_subs_epu8(input, incomplete_max);
+    }
+    prev_input = input;
+  }
+  // The zero padding also catches a sequence cut off by the end.
+  uint8_t tail[32];
+  memset(tail, 0, sizeof(tail));
+  memcpy(tail, p, end - p);
+  error = _mm256_or_si256(error, CheckBlockAVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(tail)), prev_input));
+  return _mm256_testz_si256(error, error);
+}
+#endif // UTIL_UTF8_AVX2
+
+typedef bool (*ValidateFunction)(const uint8_t *p, const uint8_t *end);
+
+struct ValidateDispatch {
+  ValidateDispatch() : validate(&ValidatePortable), avx2(false) {
+#ifdef UTIL_UTF8_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+      validate = &ValidateAVX2;
+      avx2 = true;
+    }
+#endif
+  }
+
+  ValidateFunction validate;
+  bool avx2;
+};
+
+const ValidateDispatch &GetValidateDispatch() {
+  static const ValidateDispatch dispatch;
+  return dispatch;
+}
+
+} // namespace
+
+bool IsUTF8(const StringPiece &str) {
+  const uint8_t *p = reinterpret_cast<const uint8_t*>(str.data());
+  // Short strings, like most tokens, aren't worth a padded vector block.
+  if (str.size() < 32) return ValidatePortable(p, p + str.size());
+  return GetValidateDispatch().validate(p, p + str.size());
+}
+
+bool IsUTF8Portable(const StringPiece &str) {
+  const uint8_t *p = reinterpret_cast<const uint8_t*>(str.data());
+  return ValidatePortable(p, p + str.size());
+}
+
+bool IsUTF8UsesAVX2() {
+  return GetValidateDispatch().avx2;
 }
 
 bool IsPunctuation(const StringPiece &str) throw(NotUTF8Exception) {
@@ -66,7 +289,7 @@ bool IsPunctuation(const StringPiece &str) throw(NotUTF8Exception) {
     if (character < 0) {
       throw NotUTF8Exception(str);
     }
-    if (!u_ispunct(character)) return false;
+    if (!HasProperty(character, kPunct)) return false;
   }
   return true;
 }
@@ -76,97 +299,597 @@ void ToLower(const UnicodeString &in, UnicodeString &out) {
   out.toLower();
 }
 
+void ToLower(const UnicodeString &in, UnicodeString &out, const char *locale) {
+  // u_strToLower takes the locale by name, so there is no object to open.
+  UnicodeString ret;
+  int32_t capacity = in.length() + in.length() / 2 + 1;
+  while (true) {
+    UErrorCode err = U_ZERO_ERROR;
+    int32_t length = u_strToLower(ret.getBuffer(capacity), capacity, in.getBuffer(), in.length(), locale, &err);
+    ret.releaseBuffer(U_SUCCESS(err) ? length : 0);
+    if (err != U_BUFFER_OVERFLOW_ERROR) break;
+    capacity = length;
+  }
+  out.swap(ret);
+}
+
+CaseMap::CaseMap(const char *locale) {
+  UErrorCode err_csm = U_ZERO_ERROR;
+  case_map_ = ucasemap_open(locale, 0, &err_csm);
+  if (U_FAILURE(err_csm)) {
+    std::cerr << "Failed to initialize case map." << std::endl;
+    abort();
+  }
+  // Turkish and Azeri take I to dotless i.  Other locales only differ on
+  // non-ASCII characters, which go to ICU along with their context.
+  const char *name = ucasemap_getLocale(case_map_);
+  StringPiece language(name, strcspn(name, "_-@"));
+  standard_ascii_ = language != "tr" && language != "tur" && language != "az" && language != "aze";
+}
+
+CaseMap::~CaseMap() {
+  ucasemap_close(case_map_);
+}
+
 namespace {
-class CaseMapWrap : boost::noncopyable {
+
+boost::scoped_ptr<CaseMap> kCaseMap;
+
+boost::once_flag CaseMapFlag = BOOST_ONCE_INIT;
+
+void InitCaseMap() {
+  kCaseMap.reset(new CaseMap());
+}
+
+const CaseMap &GetCaseMap() {
+  boost::call_once(CaseMapFlag, InitCaseMap);
+  return *kCaseMap;
+}
+
+// One thread's case maps.  Jobs use a handful of locales, so a list is
+// enough and looking one up doesn't allocate.
+class ThreadCaseMaps : boost::noncopyable {
   public:
-    CaseMapWrap() : case_map_(NULL) {}
-
-    void Init() {
-      UErrorCode err_csm = U_ZERO_ERROR;
-      case_map_ = ucasemap_open(NULL, 0, &err_csm);
-      if (U_FAILURE(err_csm)) {
-        std::cerr << "Failed to initialize case map." << std::endl;
-        abort();
+    ~ThreadCaseMaps() {
+      for (std::vector<Entry>::iterator i = entries_.begin(); i != entries_.end(); ++i) {
+        delete i->map;
       }
     }
 
-    ~CaseMapWrap() {
-      if (case_map_) ucasemap_close(case_map_);
-    }
-
-    const UCaseMap *Get() const {
-      return case_map_;
+    const CaseMap &Get(const char *locale) {
+      for (std::vector<Entry>::const_iterator i = entries_.begin(); i != entries_.end(); ++i) {
+        if (locale ? (!i->is_default && i->locale == locale) : i->is_default) return *i->map;
+      }
+      Entry entry;
+      entry.is_default = !locale;
+      if (locale) entry.locale = locale;
+      entry.map = NULL;
+      entries_.push_back(entry);
+      return *(entries_.back().map = new CaseMap(locale));
     }
 
   private:
-    UCaseMap *case_map_;
+    struct Entry {
+      // NULL and "" (root) are different locales.
+      bool is_default;
+      std::string locale;
+      CaseMap *map;
+    };
+    std::vector<Entry> entries_;
 };
 
-CaseMapWrap kCaseMap;
+boost::thread_specific_ptr<ThreadCaseMaps> kThreadCaseMaps;
 
-boost::once_flag CaseMapFlag = BOOST_ONCE_INIT;
+// Lowercase ASCII from in to out up to the first non-ASCII byte.  Returns
+// the number of bytes done.
+std::size_t LowerASCII(const char *in, std::size_t size, char *out) {
+  std::size_t i = 0;
+#ifdef HAVE_SSE2
+  // Adding 0x3F takes 'A' to -128, so uppercase is what ends up below -102.
+  const __m128i shift = _mm_set1_epi8(0x3F), bound = _mm_set1_epi8(-128 + 26), bit = _mm_set1_epi8(0x20);
+  for (; i + 16 <= size; i += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+    if (_mm_movemask_epi8(v)) break;
+    __m128i upper = _mm_cmplt_epi8(_mm_add_epi8(v, shift), bound);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_or_si128(v, _mm_and_si128(upper, bit)));
+  }
+#endif
+  for (; i + 8 <= size; i += 8) {
+    uint64_t w = Load8(reinterpret_cast<const uint8_t*>(in + i));
+    if (w & kHighBits) break;
+    // High bit of each byte set for >= 'A' and for > 'Z'.  No byte carries
+    // into the next because they are all below 0x80.
+    uint64_t upper = (w + 0x3F3F3F3F3F3F3F3FULL) & ~(w + 0x2525252525252525ULL) & kHighBits;
+    w |= upper >> 2;
+    memcpy(out + i, &w, 8);
+  }
+  for (; i < size && !(in[i] & 0x80); ++i) {
+    out[i] = in[i] + ((static_cast<uint8_t>(in[i] - 'A') < 26) << 5);
+  }
+  return i;
+}
 
-void InitCaseMap() {
-  kCaseMap.Init();
+/* ASCII that is neither cased nor case-ignorable.  ICU's context dependent
+ * lowercasing (final sigma, and Lithuanian i before accents) looks through
+ * case-ignorable characters and combining marks but stops at these, so text
+ * between them can be lowercased separately with the same result.  Turkish
+ * and Azeri don't take this path.
+ */
+inline bool IsCaseBarrier(char c) {
+  return !(c & 0x80) && static_cast<uint8_t>((c | 0x20) - 'a') >= 26 && c != '\'' && c != '.' && c != ':' && c != '^' && c != '`';
 }
 
-const UCaseMap *GetCaseMap() {
-  boost::call_once(CaseMapFlag, InitCaseMap);
-  return kCaseMap.Get();
+
+// Lowercase [start, stop) of in with ICU into out at written, growing out if
+// needed, and return the number of bytes written.
+std::size_t LowerICU(const UCaseMap *case_map, const StringPiece &in, const char *start, const char *stop, std::size_t written, std::string &out) {
+  UErrorCode err_lower = U_ZERO_ERROR;
+  int32_t need = ucasemap_utf8ToLower(case_map, &out[0] + written, out.size() - written, start, stop - start, &err_lower);
+  if (err_lower == U_BUFFER_OVERFLOW_ERROR) {
+    // Dotless i doubles in size.  Leave room for the rest as well.
+    out.resize(written + need + (in.data() + in.size() - stop) * 2);
+    err_lower = U_ZERO_ERROR;
+    need = ucasemap_utf8ToLower(case_map, &out[0] + written, out.size() - written, start, stop - start, &err_lower);
+  }
+  if (U_FAILURE(err_lower)) throw NotUTF8Exception(in, err_lower);
+  return need;
 }
 
 } // namespace
 
+const CaseMap &ThreadCaseMap(const char *locale) {
+  ThreadCaseMaps *maps = kThreadCaseMaps.get();
+  if (!maps) kThreadCaseMaps.reset(maps = new ThreadCaseMaps());
+  return maps->Get(locale);
+}
+
 void ToLower(const StringPiece &in, std::string &out) throw(NotUTF8Exception) {
-  const UCaseMap *csm = GetCaseMap();
-  while (true) {
-    UErrorCode err_lower = U_ZERO_ERROR;
-    size_t need = ucasemap_utf8ToLower(csm, &out[0], out.size(), in.data(), in.size(), &err_lower);
-    if (err_lower == U_BUFFER_OVERFLOW_ERROR) {
-      // Hopefully ensure convergence.
-      out.resize(std::max(out.size(), need) + 10);
-    } else if (U_FAILURE(err_lower)) {
-      throw NotUTF8Exception(in, err_lower);
-    } else if (need > out.size()) {
-      out.resize(need + 10);
-    } else {
-      out.resize(need);
-      return;
+  ToLower(in, out, GetCaseMap());
+}
+
+void ToLower(const StringPiece &in, std::string &out, const CaseMap &map) throw(NotUTF8Exception) {
+  const UCaseMap *case_map = map.Get();
+  // U+0130 goes from 2 to 3 bytes, the most any character grows in the root
+  // locale.
+  if (!map.StandardASCII()) {
+    out.resize(in.size() + in.size() / 2);
+    out.resize(LowerICU(case_map, in, in.data(), in.data() + in.size(), 0, out));
+    return;
+  }
+  out.resize(in.size());
+  std::size_t written = LowerASCII(in.data(), in.size(), &out[0]);
+  if (written == static_cast<std::size_t>(in.size())) return;
+
+  out.resize(in.size() + in.size() / 2);
+  const char *const begin = in.data(), *const end = begin + in.size();
+  const char *from = begin + written;
+  while (from != end) {
+    // Give ICU everything between barriers around the non-ASCII, rewriting
+    // the ASCII already written.
+    const char *start = from;
+    while (start != begin && !IsCaseBarrier(start[-1])) --start;
+    written -= from - start;
+    const char *stop = from;
+    while (true) {
+      while (stop != end && !IsCaseBarrier(*stop)) ++stop;
+      // Keep going through short ASCII gaps rather than calling ICU again.
+      const char *next = stop;
+      while (next != end && next - stop < 32 && !(*next & 0x80)) ++next;
+      if (next == end || !(*next & 0x80)) break;
+      stop = next;
     }
+    written += LowerICU(case_map, in, start, stop, written, out);
+    // Lithuanian grows more than the root locale, so the ASCII after might not
+    // fit.
+    std::size_t left = end - stop;
+    if (out.size() - written < left) out.resize(written + left + left / 2);
+    std::size_t ascii = LowerASCII(stop, end - stop, &out[0] + written);
+    written += ascii;
+    from = stop + ascii;
+  }
+  out.resize(written);
+}
+
+namespace {
+
+// ICU owns the instance, so it is never deleted.
+const Normalizer2 *kNFKC = NULL;
+
+boost::once_flag NFKCFlag = BOOST_ONCE_INIT;
+
+void InitNFKC() {
+  UErrorCode err = U_ZERO_ERROR;
+  kNFKC = Normalizer2::getNFKCInstance(err);
+  if (U_FAILURE(err)) {
+    std::cerr << "Failed to load NFKC data: " << u_errorName(err) << std::endl;
+    abort();
   }
 }
 
+const Normalizer2 &GetNFKC() {
+  boost::call_once(NFKCFlag, InitNFKC);
+  return *kNFKC;
+}
+
+// Length of the ASCII prefix.
+std::size_t ASCIIPrefix(const StringPiece &str) {
+  const uint8_t *const begin = reinterpret_cast<const uint8_t*>(str.data());
+  const uint8_t *p = begin, *const end = begin + str.size();
+  while (end - p >= 8 && !(Load8(p) & kHighBits)) p += 8;
+  while (p != end && *p < 0x80) ++p;
+  return p - begin;
+}
+
+} // namespace
+
 void Normalize(const UnicodeString &in, UnicodeString &out) throw(NotUTF8Exception, NormalizeException) {
+  const Normalizer2 &nfkc = GetNFKC();
   UErrorCode errorcode = U_ZERO_ERROR;
-  Normalizer::normalize(in, UNORM_NFKC, 0, out, errorcode);
+  // Most text is already normalized, so only normalize after the part that
+  // quick check says is fine.
+  int32_t span = nfkc.spanQuickCheckYes(in, errorcode);
+  if (U_FAILURE(errorcode)) throw NormalizeException(in, errorcode);
+  if (span == in.length()) {
+    out = in;
+    return;
+  }
+  out.setTo(in, 0, span);
+  nfkc.normalizeSecondAndAppend(out, in.tempSubString(span), errorcode);
   if (U_FAILURE(errorcode)) throw NormalizeException(in, errorcode);
 }
 
 void Normalize(const StringPiece &in, std::string &out) throw(NotUTF8Exception, NormalizeException) {
-  UnicodeString asuni(UnicodeString::fromUTF8(in));
-  if (asuni.isBogus()) throw NotUTF8Exception(in);
-  UnicodeString normalized;
-  Normalize(asuni, normalized);
-  out.clear();
-  normalized.toUTF8String(out);
-}
-
-struct FlattenData {
-  struct LongReplace {
-    LongReplace(const UnicodeString &from_suffix_in, const UnicodeString &to_in, bool right_boundary_in) : from_suffix(from_suffix_in), to(to_in), right_boundary(right_boundary_in) {}
-    // from except the first character
-    UnicodeString from_suffix;
-    UnicodeString to;
-    bool right_boundary;
-  };
-  struct Start {
-    // longer matches beginning with the same character.  
-    std::vector<LongReplace> longer;
-    // Fallback if nothing in longer matches.
-    UnicodeString character;
-  };
-  boost::unordered_map<UChar32, Start> starts;
+  std::size_t ascii = ASCIIPrefix(in);
+  if (ascii == static_cast<std::size_t>(in.size())) {
+    out.assign(in.data(), in.size());
+    return;
+  }
+  if (!IsUTF8(in)) {
+    // ICU would copy bad bytes through, but converting to UTF-16 has always
+    // turned them into U+FFFD.
+    UnicodeString asuni(UnicodeString::fromUTF8(in));
+    if (asuni.isBogus()) throw NotUTF8Exception(in);
+    UnicodeString normalized;
+    Normalize(asuni, normalized);
+    out.clear();
+    normalized.toUTF8String(out);
+    return;
+  }
+  // ASCII is normalized and nothing before it can change, but the last ASCII
+  // character may compose with what follows.
+  if (ascii) --ascii;
+  out.assign(in.data(), ascii);
+  StringByteSink<std::string> sink(&out);
+  UErrorCode errorcode = U_ZERO_ERROR;
+  GetNFKC().normalizeUTF8(0, StringPiece(in.data() + ascii, in.size() - ascii), sink, NULL, errorcode);
+  if (U_FAILURE(errorcode)) throw NotUTF8Exception(in, errorcode);
+}
+
+/* Replacement rules for one language compiled into a trie over the UTF-8
+ * bytes of what they replace.  Rules for a single character apply only if no
+ * longer rule beginning with that character matches, and among longer rules
+ * the one added first wins.  A later rule for the same single character
+ * replaces an earlier one.
+ */
+class FlattenData {
+  public:
+    FlattenData() {}
+
+    // to is normalized.  A right_boundary rule only matches before a space or
+    // the end.
+    void Add(const char *from, const char *to, bool right_boundary);
+
+    // Build the trie from the rules added so far.
+    void Compile();
+
+    void Apply(const StringPiece &in, std::string &out) const;
+
+    // The same as Apply to the lowercase of in, which is ASCII.
+    void ApplyLowerASCII(const StringPiece &in, std::string &out) const;
+
+    // The same as Normalize of Apply to in, which is UTF-8, in one pass over
+    // in.  pending is scratch.
+    void ApplyNormalize(const StringPiece &in, std::string &pending, std::string &out) const;
+
+    // Whether flattening ASCII leaves it normalized: every rule for ASCII
+    // replaces it with text that nothing before can compose with.
+    bool ASCIIStaysNormal() const { return ascii_stays_normal_; }
+
+  private:
+    // Whether the text at p is the end or a space.
+    static bool AtBoundary(const uint8_t *p, const uint8_t *end);
+
+    // The rule for the character of length bytes at p, reading each byte
+    // through read, or kNone to keep the character.  Sets after to where
+    // the text it replaces ends.
+    template <class Read> uint32_t Match(const uint8_t *p, const uint8_t *end, int32_t length, Read read, const uint8_t *&after) const;
+
+    // Skips ASCII that stays as it is: bytes that start no rule, or only
+    // rules longer than a byte that the next byte doesn't continue.
+    template <class Read> const uint8_t *SkipPlain(const uint8_t *p, const uint8_t *end, Read read) const;
+
+    struct Rule {
+      std::string from, to;
+      bool right_boundary;
+    };
+    std::vector<Rule> rules_;
+
+    static const uint32_t kNone = static_cast<uint32_t>(-1);
+
+    struct Node {
+      // Children are in child_bytes_ and child_nodes_ from begin to end.
+      uint32_t begin, end;
+      // Index in rules_ of the rule that ends here, or kNone.
+      uint32_t rule;
+    };
+    std::vector<Node> nodes_;
+    std::vector<uint8_t> child_bytes_;
+    std::vector<uint32_t> child_nodes_;
+
+    // Node for each first byte, or 0 (the root) if no rule starts with it.
+    uint32_t root_[256];
+
+    bool ascii_stays_normal_;
+};
+
+const uint32_t FlattenData::kNone;
+
+namespace {
+// Length of the character at the start of a rule, which is valid UTF-8.
+std::size_t FirstCharLength(const std::string &str) {
+  int32_t offset = 0;
+  UChar32 character;
+  U8_NEXT(str.data(), offset, static_cast<int32_t>(str.size()), character);
+  if (character < 0) throw NotUTF8Exception(str);
+  return offset;
+}
+} // namespace
+
+void FlattenData::Add(const char *from, const char *to, bool right_boundary) {
+  Rule rule;
+  rule.from = from;
+  Normalize(to, rule.to);
+  rule.right_boundary = right_boundary;
+  rules_.push_back(rule);
+}
+
+void FlattenData::Compile() {
+  // Build with maps first, then lay the children out contiguously.
+  std::vector<std::map<uint8_t, uint32_t> > children(1);
+  std::vector<uint32_t> rule_at(1, kNone);
+  for (uint32_t r = 0; r < rules_.size(); ++r) {
+    const std::string &from = rules_[r].from;
+    uint32_t node = 0;
+    for (std::string::const_iterator i = from.begin(); i != from.end(); ++i) {
+      std::map<uint8_t, uint32_t>::iterator found = children[node].find(static_cast<uint8_t>(*i));
+      if (found == children[node].end()) {
+        children[node][static_cast<uint8_t>(*i)] = children.size();
+        node = children.size();
+        children.resize(children.size() + 1);
+        rule_at.push_back(kNone);
+      } else {
+        node = found->second;
+      }
+    }
+    if (rule_at[node] == kNone || FirstCharLength(from) == from.size()) rule_at[node] = r;
+  }
+  nodes_.resize(children.size());
+  child_bytes_.clear();
+  child_nodes_.clear();
+  for (uint32_t n = 0; n < children.size(); ++n) {
+    nodes_[n].begin = child_bytes_.size();
+    for (std::map<uint8_t, uint32_t>::const_iterator i = children[n].begin(); i != children[n].end(); ++i) {
+      child_bytes_.push_back(i->first);
+      child_nodes_.push_back(i->second);
+    }
+    nodes_[n].end = child_bytes_.size();
+    nodes_[n].rule = rule_at[n];
+  }
+  std::fill(root_, root_ + 256, 0);
+  for (std::map<uint8_t, uint32_t>::const_iterator i = children[0].begin(); i != children[0].end(); ++i) {
+    root_[i->first] = i->second;
+  }
+  // Each replacement is normalized on its own, so only its first character
+  // could compose with what comes before.
+  const Normalizer2 &nfkc = GetNFKC();
+  ascii_stays_normal_ = true;
+  for (std::vector<Rule>::const_iterator i = rules_.begin(); i != rules_.end(); ++i) {
+    if (static_cast<uint8_t>(i->from[0]) >= 0x80 || i->to.empty()) continue;
+    int32_t offset = 0;
+    UChar32 character;
+    U8_NEXT(i->to.data(), offset, static_cast<int32_t>(i->to.size()), character);
+    if (!nfkc.hasBoundaryBefore(character)) ascii_stays_normal_ = false;
+  }
+}
+
+bool FlattenData::AtBoundary(const uint8_t *p, const uint8_t *end) {
+  if (p == end) return true;
+  int32_t offset = 0;
+  UChar32 character;
+  U8_NEXT(p, offset, static_cast<int32_t>(std::min<std::ptrdiff_t>(end - p, 4)), character);
+  return character >= 0 && u_isspace(character);
+}
+
+namespace {
+struct SameByte {
+  uint8_t operator()(uint8_t byte) const { return byte; }
+};
+
+struct LowerByte {
+  uint8_t operator()(uint8_t byte) const { return byte + ((static_cast<uint8_t>(byte - 'A') < 26) << 5); }
 };
+} // namespace
+
+template <class Read> uint32_t FlattenData::Match(const uint8_t *p, const uint8_t *end, int32_t length, Read read, const uint8_t *&after) const {
+  uint32_t single = kNone, longer = kNone;
+  const uint8_t *longer_end = NULL;
+  uint32_t node = root_[read(*p)];
+  for (const uint8_t *q = p + 1; node; ) {
+    const Node &at = nodes_[node];
+    if (at.rule != kNone) {
+      if (q - p == length) {
+        single = at.rule;
+      } else if (at.rule < longer && (!rules_[at.rule].right_boundary || AtBoundary(q, end))) {
+        longer = at.rule;
+        longer_end = q;
+      }
+    }
+    if (q == end) break;
+    const uint8_t *child = std::find(&child_bytes_[0] + at.begin, &child_bytes_[0] + at.end, read(*q));
+    node = (child == &child_bytes_[0] + at.end) ? 0 : child_nodes_[child - &child_bytes_[0]];
+    ++q;
+  }
+  if (longer != kNone) {
+    after = longer_end;
+    return longer;
+  }
+  after = p + length;
+  return single;
+}
+
+template <class Read> const uint8_t *FlattenData::SkipPlain(const uint8_t *p, const uint8_t *end, Read read) const {
+  for (; p != end && *p < 0x80; ++p) {
+    uint32_t node = root_[read(*p)];
+    if (!node) continue;
+    const Node &at = nodes_[node];
+    if (at.rule != kNone) return p;
+    if (p + 1 != end && std::find(&child_bytes_[0] + at.begin, &child_bytes_[0] + at.end, read(p[1])) != &child_bytes_[0] + at.end) return p;
+  }
+  return p;
+}
+
+void FlattenData::Apply(const StringPiece &in, std::string &out) const {
+  out.clear();
+  out.reserve(in.size());
+  const uint8_t *p = reinterpret_cast<const uint8_t*>(in.data());
+  const uint8_t *const end = p + in.size();
+  while (true) {
+    // Copy ASCII that no rule applies to in one go.
+    const uint8_t *plain = p;
+    p = SkipPlain(p, end, SameByte());
+    out.append(reinterpret_cast<const char*>(plain), p - plain);
+    if (p == end) return;
+
+    int32_t length = 1;
+    if (*p >= 0x80) {
+      UChar32 character;
+      length = 0;
+      U8_NEXT(p, length, static_cast<int32_t>(std::min<std::ptrdiff_t>(end - p, 4)), character);
+      if (character < 0) {
+        // Like UnicodeString::fromUTF8, which this used to go through.
+        out.append("\xEF\xBF\xBD", 3);
+        p += length;
+        continue;
+      }
+    }
+    const uint8_t *after;
+    uint32_t rule = Match(p, end, length, SameByte(), after);
+    if (rule == kNone) {
+      out.append(reinterpret_cast<const char*>(p), length);
+    } else {
+      out.append(rules_[rule].to);
+    }
+    p = after;
+  }
+}
+
+void FlattenData::ApplyLowerASCII(const StringPiece &in, std::string &out) const {
+  out.clear();
+  out.reserve(in.size());
+  const uint8_t *p = reinterpret_cast<const uint8_t*>(in.data());
+  const uint8_t *const end = p + in.size();
+  LowerByte lower;
+  while (true) {
+    const uint8_t *plain = p;
+    p = SkipPlain(p, end, lower);
+    if (p != plain) {
+      std::size_t at = out.size();
+      out.append(reinterpret_cast<const char*>(plain), p - plain);
+      LowerASCII(&out[at], p - plain, &out[at]);
+    }
+    if (p == end) return;
+    // Case doesn't change whether a byte is a space, so AtBoundary can look
+    // at the original.
+    const uint8_t *after;
+    uint32_t rule = Match(p, end, 1, lower, after);
+    if (rule == kNone) {
+      out += static_cast<char>(lower(*p));
+    } else {
+      out.append(rules_[rule].to);
+    }
+    p = after;
+  }
+}
+
+namespace {
+// Appends NFKC of segment, which begins at a normalization boundary, to out.
+void AppendNormalized(const std::string &segment, std::string &out) {
+  if (ASCIIPrefix(segment) == segment.size()) {
+    out += segment;
+    return;
+  }
+  StringByteSink<std::string> sink(&out);
+  UErrorCode errorcode = U_ZERO_ERROR;
+  GetNFKC().normalizeUTF8(0, segment, sink, NULL, errorcode);
+  if (U_FAILURE(errorcode)) throw NotUTF8Exception(segment, errorcode);
+}
+
+// ASCII runs at least this long end a segment.  Shorter ones, like the
+// spaces between words of a non-Latin script, go in the segment rather than
+// call ICU for each word.
+const std::size_t kSegmentASCII = 16;
+} // namespace
+
+/* The flattened text is normalized a segment at a time.  Every ASCII
+ * character begins an NFKC segment and is normalized already, so a long run
+ * of ASCII that no rule touches ends the pending segment and is copied
+ * straight to out, except for its last character, which may compose with
+ * what follows.  Other text no rule touches is copied to the pending segment
+ * in bulk.
+ */
+void FlattenData::ApplyNormalize(const StringPiece &in, std::string &pending, std::string &out) const {
+  out.clear();
+  out.reserve(in.size());
+  pending.clear();
+  const uint8_t *p = reinterpret_cast<const uint8_t*>(in.data());
+  const uint8_t *const end = p + in.size();
+  while (true) {
+    const uint8_t *plain = p;
+    p = SkipPlain(p, end, SameByte());
+    if (static_cast<std::size_t>(p - plain) >= kSegmentASCII) {
+      AppendNormalized(pending, out);
+      out.append(reinterpret_cast<const char*>(plain), p - plain - 1);
+      pending.assign(1, static_cast<char>(p[-1]));
+    } else {
+      pending.append(reinterpret_cast<const char*>(plain), p - plain);
+    }
+    // In valid UTF-8, the rest of a character whose lead byte starts no rule
+    // starts none either.
+    plain = p;
+    while (p != end && *p >= 0x80 && !root_[*p]) ++p;
+    if (p != plain) {
+      pending.append(reinterpret_cast<const char*>(plain), p - plain);
+      continue;
+    }
+    if (p == end) break;
+
+    int32_t length = 1;
+    if (*p >= 0x80) {
+      UChar32 character;
+      length = 0;
+      U8_NEXT(p, length, static_cast<int32_t>(std::min<std::ptrdiff_t>(end - p, 4)), character);
+    }
+    const uint8_t *after;
+    uint32_t rule = Match(p, end, length, SameByte(), after);
+    if (rule == kNone) {
+      pending.append(reinterpret_cast<const char*>(p), length);
+    } else {
+      pending.append(rules_[rule].to);
+    }
+    p = after;
+  }
+  AppendNormalized(pending, out);
+}
 
 namespace {
 
@@ -178,24 +901,8 @@ struct ReplaceRule {
 };
 
 template <unsigned rulecount> void AddToFlatten(const ReplaceRule (&replace)[rulecount], FlattenData &out, bool right_boundary = false) {
-  FlattenData::Start default_start;
   for (const ReplaceRule *i = replace; i != replace + rulecount; ++i) {
-    const char *to = i->to;
-    UnicodeString to_unicode;
-    Normalize(UnicodeString::fromUTF8(to), to_unicode);
-
-    const char *from = i->from;
-    int32_t offset = 0;
-    int32_t length = strlen(from);
-    UChar32 from_char;
-    U8_NEXT(from, offset, length, from_char);
-    if (from_char < 0) throw NotUTF8Exception(from);
-    if (offset == length) {
-      out.starts[from_char].character = to_unicode;
-    } else {
-      default_start.character.setTo(from_char);
-      out.starts.insert(std::make_pair(from_char, default_start)).first->second.longer.push_back(FlattenData::LongReplace(UnicodeString::fromUTF8(from + offset), to_unicode, right_boundary));
-    }
+    out.Add(i->from, i->to, right_boundary);
   }
 }
 
@@ -304,6 +1011,10 @@ void AllFlattenDataPopulate() {
   AddToFlatten(kReplaceForFrench, french);
   // TODO: Czech quotes.  
   (*kAllFlattenData)["cs"] = (*kAllFlattenData)["cz"];
+
+  for (boost::unordered_map<StringPiece, FlattenData>::iterator i = kAllFlattenData->begin(); i != kAllFlattenData->end(); ++i) {
+    i->second.Compile();
+  }
 }
 
 } // namespace
@@ -325,43 +1036,72 @@ const FlattenData &LookupFlatten(const StringPiece &language) throw(UnsupportedL
 Flatten::Flatten(const StringPiece &language) throw(UnsupportedLanguageException) : data_(LookupFlatten(language)) {}
 
 void Flatten::Apply(const UnicodeString &in, UnicodeString &out) const throw(NotUTF8Exception) {
-  out.truncate(0);
-
-  for (int32_t i = 0; i < in.length();) {
-    UChar32 character = in.char32At(i);
-    assert(character > 0);
-    boost::unordered_map<UChar32, FlattenData::Start>::const_iterator entry(data_.starts.find(character));
-    if (entry != data_.starts.end()) {
-      const FlattenData::Start &start = entry->second;
-      std::vector<FlattenData::LongReplace>::const_iterator j(start.longer.begin());
-      for (; j != start.longer.end(); ++j) {
-        const UnicodeString &from_suffix = j->from_suffix;
-        int32_t ending = i + 1 + from_suffix.length();
-        if (!in.compare(i + 1, from_suffix.length(), from_suffix) && 
-            (!j->right_boundary || (in.length() == ending) || u_isspace(in.char32At(ending)))) {
-          // Found longer match.
-          out.append(j->to);
-          i += from_suffix.length();
-          break;
-        }
+  std::string utf8, flattened;
+  in.toUTF8String(utf8);
+  data_.Apply(utf8, flattened);
+  out = UnicodeString::fromUTF8(flattened);
+}
+
+void Flatten::Apply(const StringPiece &in, std::string &out) const throw(NotUTF8Exception) {
+  data_.Apply(in, out);
+}
+
+Transform::Transform(const CaseMap *lower, const Flatten *flatten, bool normalize)
+  : lower_(lower), flatten_(flatten ? &flatten->data_ : NULL), normalize_(normalize) {
+  ascii_pass_ = (!lower_ || lower_->StandardASCII()) && (!flatten_ || !normalize_ || flatten_->ASCIIStaysNormal());
+}
+
+void Transform::Apply(const StringPiece &in, std::string &out) throw(NotUTF8Exception, NormalizeException) {
+  StringPiece line(in);
+  std::string *to = &buffer_[0], *other = &buffer_[1];
+  if (!IsUTF8(line)) {
+    // Bad bytes have always become U+FFFD.
+    to->clear();
+    UnicodeString::fromUTF8(line).toUTF8String(*to);
+    line = StringPiece(to->data(), to->size());
+    std::swap(to, other);
+  }
+  if (ascii_pass_ && ASCIIPrefix(line) == static_cast<std::size_t>(line.size())) {
+    if (flatten_) {
+      if (lower_) {
+        flatten_->ApplyLowerASCII(line, out);
+      } else {
+        flatten_->Apply(line, out);
       }
-      // Fallback on character
-      if (j == start.longer.end()) out.append(start.character);
-      ++i;
+    } else if (lower_) {
+      out.resize(line.size());
+      LowerASCII(line.data(), line.size(), &out[0]);
     } else {
-      out.append(character);
-      ++i;
+      out.assign(line.data(), line.size());
     }
+    return;
+  }
+  // Each step reads line and writes *to, which becomes the next line.
+  if (lower_) {
+    ToLower(line, *to, *lower_);
+    line = StringPiece(to->data(), to->size());
+    std::swap(to, other);
+  }
+  if (flatten_ && normalize_) {
+    flatten_->ApplyNormalize(line, *to, out);
+    return;
+  }
+  if (flatten_) {
+    flatten_->Apply(line, *to);
+    line = StringPiece(to->data(), to->size());
+    std::swap(to, other);
+  }
+  if (normalize_) {
+    Normalize(line, *to);
+    line = StringPiece(to->data(), to->size());
+    std::swap(to, other);
+  }
+  if (line.data() == other->data()) {
+    // Hand over the buffer instead of copying and keep out's.
+    out.swap(*other);
+  } else {
+    out.assign(line.data(), line.size());
   }
-}
-
-void Flatten::Apply(const StringPiece &in, std::string &out) const throw(NotUTF8Exception) {
-  UnicodeString asuni(UnicodeString::fromUTF8(in));
-  if (asuni.isBogus()) throw NotUTF8Exception(in);
-  UnicodeString normalized;
-  Apply(asuni, normalized);
-  out.clear();
-  normalized.toUTF8String(out);
 }
 
 } // namespace utf8
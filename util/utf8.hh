@@ -5,6 +5,8 @@
 
 #include "util/string_piece.hh"
 
+#include <boost/utility.hpp>
+
 #include <exception>
 #include <string>
 
@@ -14,6 +16,8 @@ U_NAMESPACE_BEGIN
 class UnicodeString;
 U_NAMESPACE_END
 
+struct UCaseMap;
+
 namespace utf8 {
 
 class NormalizeException : public std::exception {
@@ -61,13 +65,54 @@ class UnsupportedLanguageException : public std::exception {
     std::string what_;
 };
 
+/* Whether text is well-formed UTF-8, exactly as ICU's U8_NEXT decides: no
+ * overlong forms, surrogates, or code points above U+10FFFF.  NUL is allowed.
+ * Validates 32 bytes at a time with AVX2 when the CPU has it.
+ */
 bool IsUTF8(const StringPiece &text);
 
+// The same check without the AVX2 path, for testing.
+bool IsUTF8Portable(const StringPiece &text);
+
+// Whether IsUTF8 found and uses AVX2.
+bool IsUTF8UsesAVX2();
+
 bool IsPunctuation(const StringPiece &text) throw(NotUTF8Exception);
 
-// TODO: Implement these in a way that doesn't botch Turkish.
+// An ICU case map for one locale, so a thread can lowercase with its own.
+class CaseMap : boost::noncopyable {
+  public:
+    // NULL is ICU's default locale.
+    explicit CaseMap(const char *locale = NULL);
+    ~CaseMap();
+
+    const UCaseMap *Get() const { return case_map_; }
+
+    // Whether ASCII lowercases as in the root locale.  Only Turkish and Azeri
+    // do not.
+    bool StandardASCII() const { return standard_ascii_; }
+
+  private:
+    UCaseMap *case_map_;
+    bool standard_ascii_;
+};
+
+/* The calling thread's case map for locale, opened on first use and closed
+ * when the thread exits.  NULL is ICU's default locale.  No locking, so
+ * threads lowercasing at once don't wait on each other.
+ */
+const CaseMap &ThreadCaseMap(const char *locale);
+
+// In ICU's default locale.
 void ToLower(const UnicodeString &in, UnicodeString &out);
+void ToLower(const UnicodeString &in, UnicodeString &out, const char *locale);
+// With a case map for the default locale shared by all threads.
 void ToLower(const StringPiece &in, std::string &out) throw(NotUTF8Exception);
+void ToLower(const StringPiece &in, std::string &out, const CaseMap &map) throw(NotUTF8Exception);
+// With ThreadCaseMap(locale), such as "tr", "az", or "lt" for their rules.
+inline void ToLower(const StringPiece &in, std::string &out, const char *locale) throw(NotUTF8Exception) {
+  ToLower(in, out, ThreadCaseMap(locale));
+}
 
 void Normalize(const UnicodeString &in, UnicodeString &out) throw(NotUTF8Exception, NormalizeException);
 void Normalize(const StringPiece &in, std::string &out) throw(NotUTF8Exception, NormalizeException);
@@ -82,9 +127,39 @@ class Flatten {
     void Apply(const StringPiece &in, std::string &out) const throw (NotUTF8Exception);
 
   private:
+    friend class Transform;
+
     const FlattenData &data_;
 };
 
+/* Lowercasing, flattening, and normalizing in one call, with the same result
+ * as ToLower, then Flatten::Apply, then Normalize for the steps asked for.
+ * Bad bytes become U+FFFD first.  An ASCII line takes one pass that
+ * lowercases as it flattens, which is all NFKC would do to it.  Other lines
+ * go through the steps in turn, except that flattening and normalizing are
+ * one pass in which ICU sees only the NFKC segments that aren't ASCII.
+ * Keeps its buffers between lines, so have one per thread.
+ */
+class Transform : boost::noncopyable {
+  public:
+    // NULL lower leaves case alone and NULL flatten doesn't flatten.  What they
+    // point to must outlive this.
+    Transform(const CaseMap *lower, const Flatten *flatten, bool normalize);
+
+    // Replaces out, which must not be in.
+    void Apply(const StringPiece &in, std::string &out) throw(NotUTF8Exception, NormalizeException);
+
+  private:
+    const CaseMap *const lower_;
+    const FlattenData *const flatten_;
+    const bool normalize_;
+
+    // Whether an ASCII line can take the single pass.
+    bool ascii_pass_;
+
+    std::string buffer_[2];
+};
+
 } // namespace utf8
 
 #endif
@@ -3,6 +3,18 @@
 #define BOOST_TEST_MODULE UTF8Test
 #include <boost/test/unit_test.hpp>
 
+#include <boost/bind.hpp>
+#include <boost/thread/barrier.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <unicode/normalizer2.h>
+#include <unicode/ucasemap.h>
+#include <unicode/unistr.h>
+#include <unicode/utf8.h>
+
+#include <string>
+#include <vector>
+
 #define CHECK_LOWER(ref, from) { \
   std::string out; \
   ToLower(from, out); \
@@ -25,6 +37,122 @@
 namespace utf8 {
 namespace {
 
+// What IsUTF8 used to be.
+bool ICUIsUTF8(const std::string &str) {
+  int32_t offset = 0;
+  int32_t length = static_cast<int32_t>(str.size());
+  while (offset < length) {
+    UChar32 character;
+    U8_NEXT(str.data(), offset, length, character);
+    if (character < 0) return false;
+  }
+  return true;
+}
+
+#define CHECK_VALID(str) { \
+  std::string copy(str); \
+  bool ref = ICUIsUTF8(copy); \
+  if (ref != IsUTF8(copy) || ref != IsUTF8Portable(copy)) \
+    BOOST_FAIL("Disagree with ICU (" << ref << ") on " << Escape(copy)); \
+}
+
+std::string Escape(const std::string &str) {
+  std::string ret;
+  const char kHex[] = "0123456789abcdef";
+  for (std::string::const_iterator i = str.begin(); i != str.end(); ++i) {
+    ret += "\\x";
+    ret += kHex[static_cast<uint8_t>(*i) >> 4];
+    ret += kHex[*i & 0xf];
+  }
+  return ret;
+}
+
+class Random {
+  public:
+    Random() : state_(0x853c49e6748fea9bULL) {}
+
+    uint32_t operator()(uint32_t bound) {
+      state_ = state_ * 6364136223846793005ULL + 1442695040888963407ULL;
+      return static_cast<uint32_t>(state_ >> 33) % bound;
+    }
+
+  private:
+    uint64_t state_;
+};
+
+BOOST_AUTO_TEST_CASE(Valid) {
+  BOOST_TEST_MESSAGE("AVX2: " << IsUTF8UsesAVX2());
+  BOOST_CHECK(IsUTF8(""));
+  BOOST_CHECK(IsUTF8(std::string("a\0b", 3)));
+  BOOST_CHECK(IsUTF8("\xc2\x80\xdf\xbf\xe0\xa0\x80\xed\x9f\xbf\xee\x80\x80\xef\xbf\xbf\xf0\x90\x80\x80\xf4\x8f\xbf\xbf"));
+  // Overlong, surrogate, too large, bad lead bytes, and truncated.
+  const char *kBad[] = {"\xc0\x80", "\xc1\xbf", "\xe0\x9f\xbf", "\xed\xa0\x80", "\xf0\x8f\xbf\xbf", "\xf4\x90\x80\x80", "\xf5\x80\x80\x80", "\xff", "\x80", "\xe2\x82", "a\xf0\x90\x80"};
+  for (std::size_t i = 0; i < sizeof(kBad) / sizeof(const char*); ++i) {
+    BOOST_CHECK_MESSAGE(!IsUTF8(kBad[i]), Escape(kBad[i]));
+    BOOST_CHECK_MESSAGE(!IsUTF8Portable(kBad[i]), Escape(kBad[i]));
+  }
+}
+
+// Every pair and every triple starting with a non-ASCII byte, placed on
+// either side of the 32-byte blocks.
+BOOST_AUTO_TEST_CASE(Exhaustive) {
+  const std::size_t kOffsets[] = {0, 29, 30, 31, 32, 61};
+  for (std::size_t o = 0; o < sizeof(kOffsets) / sizeof(std::size_t); ++o) {
+    std::string str(kOffsets[o] + 3, 'a');
+    for (unsigned first = 0x80; first < 0x100; ++first) {
+      str[kOffsets[o]] = first;
+      for (unsigned second = 0; second < 0x100; ++second) {
+        str[kOffsets[o] + 1] = second;
+        CHECK_VALID(str.substr(0, kOffsets[o] + 2));
+        for (unsigned third = 0x80; third < 0xc0; ++third) {
+          str[kOffsets[o] + 2] = third;
+          CHECK_VALID(str);
+        }
+      }
+    }
+  }
+}
+
+// Random mixes of code points, stray bytes, and ASCII runs, checked at every
+// prefix so sequences are cut off everywhere.
+BOOST_AUTO_TEST_CASE(Fuzz) {
+  const uint32_t kBoundaries[] = {0x7f, 0x80, 0x7ff, 0x800, 0xd7ff, 0xe000, 0xfffd, 0xffff, 0x10000, 0x10ffff};
+  const uint8_t kBytes[] = {0x00, 0x7f, 0x80, 0x8f, 0x90, 0x9f, 0xa0, 0xbf, 0xc0, 0xc1, 0xc2, 0xdf, 0xe0, 0xed, 0xef, 0xf0, 0xf4, 0xf5, 0xf8, 0xff};
+  Random rand;
+  for (std::size_t trial = 0; trial < 20000; ++trial) {
+    std::string str;
+    std::size_t pieces = rand(trial % 10 ? 12 : 60);
+    for (std::size_t p = 0; p < pieces; ++p) {
+      uint32_t code;
+      switch (rand(4)) {
+        case 0:
+          str.append(rand(40), 'a' + rand(26));
+          continue;
+        case 1:
+          str += static_cast<char>(rand(8) ? kBytes[rand(sizeof(kBytes))] : rand(256));
+          continue;
+        case 2:
+          code = kBoundaries[rand(sizeof(kBoundaries) / sizeof(uint32_t))];
+          break;
+        default:
+          code = rand(0x110000);
+          if (code >= 0xd800 && code < 0xe000) code -= 0x800;
+      }
+      char buf[4];
+      int32_t length = 0;
+      UBool error = false;
+      U8_APPEND(reinterpret_cast<uint8_t*>(buf), length, 4, code, error);
+      BOOST_REQUIRE(!error);
+      str.append(buf, length);
+    }
+    // Corrupt a byte now and then.
+    if (!str.empty() && rand(4) == 0) str[rand(str.size())] = rand(256);
+    for (std::size_t length = 0; length <= str.size(); ++length) {
+      CHECK_VALID(str.substr(0, length));
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(ASCII) {
   CHECK_LOWER("foo", "FOO");
   CHECK_LOWER("foobaz", "fooBAz");
@@ -38,6 +166,132 @@ BOOST_AUTO_TEST_CASE(Thorn) {
   CHECK_LOWER("þ", "Þ");
 }
 
+// Lowercase the whole string with ICU, as ToLower used to.
+std::string ICULower(const std::string &in, const char *locale = NULL) {
+  UErrorCode err = U_ZERO_ERROR;
+  UCaseMap *csm = ucasemap_open(locale, 0, &err);
+  std::string out(in.size() * 3 + 1, 0);
+  out.resize(ucasemap_utf8ToLower(csm, &out[0], out.size(), in.data(), in.size(), &err));
+  ucasemap_close(csm);
+  BOOST_REQUIRE(U_SUCCESS(err));
+  return out;
+}
+
+BOOST_AUTO_TEST_CASE(LowerContext) {
+  // Final sigma looks past case-ignorable ASCII but not past a space.
+  CHECK_LOWER("aς", "AΣ");
+  CHECK_LOWER("aς.", "AΣ.");
+  CHECK_LOWER("aσ.b", "AΣ.B");
+  CHECK_LOWER("aσ:b", "AΣ:B");
+  CHECK_LOWER("aς b", "AΣ B");
+  CHECK_LOWER("σ", "Σ");
+  CHECK_LOWER("the quick brown fox jumps over the lazy dog ôæ and more ascii after it",
+      "THE QUICK Brown FOX jumps OVER the LAZY dog ÔÆ AND more ASCII after IT");
+  // Grows by half.
+  CHECK_LOWER("i\xcc\x87i\xcc\x87i\xcc\x87", "İİİ");
+  // ICU passes bad bytes through.
+  CHECK_LOWER("a\xff" "b\xe2\x82", "A\xff" "B\xe2\x82");
+}
+
+BOOST_AUTO_TEST_CASE(LowerTurkish) {
+  CaseMap turkish("tr"), root("");
+  BOOST_CHECK(!turkish.StandardASCII());
+  BOOST_CHECK(root.StandardASCII());
+  std::string out;
+  ToLower("DİYARBAKIR I", out, turkish);
+  BOOST_CHECK_EQUAL("diyarbakır ı", out);
+  ToLower("DİYARBAKIR I", out, root);
+  BOOST_CHECK_EQUAL("di\xcc\x87yarbakir i", out);
+}
+
+BOOST_AUTO_TEST_CASE(LowerLocale) {
+  std::string out;
+  ToLower("DİYARBAKIR I", out, "tr");
+  BOOST_CHECK_EQUAL("diyarbakır ı", out);
+  ToLower("I", out, "az");
+  BOOST_CHECK_EQUAL("ı", out);
+  // Lithuanian keeps the dot of i under an accent.
+  ToLower("I\xcc\x80 \xc3\x8c", out, "lt");
+  BOOST_CHECK_EQUAL("i\xcc\x87\xcc\x80 i\xcc\x87\xcc\x80", out);
+  ToLower("I\xcc\x80", out, "");
+  BOOST_CHECK_EQUAL("i\xcc\x80", out);
+
+  UnicodeString lowered;
+  ToLower(UnicodeString::fromUTF8("DİYARBAKIR"), lowered, "tr");
+  BOOST_CHECK(lowered == UnicodeString::fromUTF8("diyarbakır"));
+  // In place, and long enough to grow past the first guess.
+  lowered = UnicodeString::fromUTF8("\xc3\x8c\xc3\x8c\xc3\x8c\xc3\x8c");
+  ToLower(lowered, lowered, "lt");
+  BOOST_CHECK(lowered == UnicodeString::fromUTF8("i\xcc\x87\xcc\x80i\xcc\x87\xcc\x80i\xcc\x87\xcc\x80i\xcc\x87\xcc\x80"));
+}
+
+struct CaseMapChecks {
+  bool same_twice, locales_differ, default_not_root, turkish_ascii, root_ascii, unshared;
+};
+
+/* Boost.Test checks aren't thread safe, so this records what to check.  A
+ * thread's maps are freed when it exits, so maps are only compared while every
+ * thread is held at the barrier.
+ */
+void CheckCaseMaps(boost::barrier *barrier, const CaseMap **turkish, std::size_t index, std::size_t count, CaseMapChecks *out) {
+  const CaseMap &tr = ThreadCaseMap("tr");
+  out->same_twice = &tr == &ThreadCaseMap("tr");
+  out->locales_differ = &tr != &ThreadCaseMap(NULL);
+  out->default_not_root = &ThreadCaseMap(NULL) != &ThreadCaseMap("");
+  out->turkish_ascii = tr.StandardASCII();
+  out->root_ascii = ThreadCaseMap("").StandardASCII();
+  turkish[index] = &tr;
+  barrier->wait();
+  out->unshared = true;
+  for (std::size_t i = 0; i < count; ++i) {
+    if (i != index && turkish[i] == &tr) out->unshared = false;
+  }
+  barrier->wait();
+}
+
+BOOST_AUTO_TEST_CASE(ThreadCaseMaps) {
+  // Two threads and this one.
+  const std::size_t kCount = 3;
+  boost::barrier barrier(kCount);
+  const CaseMap *turkish[kCount];
+  CaseMapChecks checks[kCount];
+  boost::thread_group threads;
+  for (std::size_t t = 0; t < kCount - 1; ++t) {
+    threads.create_thread(boost::bind(&CheckCaseMaps, &barrier, turkish, t, kCount, &checks[t]));
+  }
+  CheckCaseMaps(&barrier, turkish, kCount - 1, kCount, &checks[kCount - 1]);
+  threads.join_all();
+  for (std::size_t t = 0; t < kCount; ++t) {
+    BOOST_CHECK(checks[t].same_twice);
+    BOOST_CHECK(checks[t].locales_differ);
+    BOOST_CHECK(checks[t].default_not_root);
+    BOOST_CHECK(!checks[t].turkish_ascii);
+    BOOST_CHECK(checks[t].root_ascii);
+    BOOST_CHECK(checks[t].unshared);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(LowerFuzz) {
+  const char *kPieces[] = {"A", "z", "Q", "'", ".", ":", "^", "`", " ", "-", "0", "\t", "Σ", "σ", "İ", "Ⱥ", "ß", "Ǆ", "Ω", "Я", "\xcc\x81", "\xe2\x80\x8b", "\xff", "\xc3", "ONE LONGER UPPERCASE RUN", "mixed Case ascii Text", "I", "J", "Į", "Ì", "\xcc\x80", "\xcc\xa3"};
+  const char *kLocales[] = {NULL, "lt", "tr", "az", "nl"};
+  Random rand;
+  for (std::size_t trial = 0; trial < 20000; ++trial) {
+    std::string str;
+    for (std::size_t p = rand(20); p; --p) {
+      str += kPieces[rand(sizeof(kPieces) / sizeof(const char*))];
+    }
+    const char *locale = kLocales[rand(sizeof(kLocales) / sizeof(const char*))];
+    std::string out;
+    if (locale) {
+      ToLower(str, out, locale);
+    } else {
+      ToLower(str, out);
+    }
+    std::string ref(ICULower(str, locale));
+    if (out != ref) BOOST_FAIL("Lowercasing " << Escape(str) << " in " << (locale ? locale : "the default locale") << " gave " << Escape(out) << " instead of " << Escape(ref));
+  }
+}
+
 BOOST_AUTO_TEST_CASE(NormalizeASCII) {
   CHECK_NORMALIZE("foo", "foo");
 }
@@ -55,6 +309,43 @@ BOOST_AUTO_TEST_CASE(NormalizeFive) {
   CHECK_NORMALIZE("5", "⁵");
 }
 
+BOOST_AUTO_TEST_CASE(NormalizeCompose) {
+  // The ASCII before combining marks composes with them.
+  CHECK_NORMALIZE("abcé", "abce\xcc\x81");
+  CHECK_NORMALIZE("ab\xef\xbf\xbd" "c", "ab\xff" "c");
+}
+
+// Normalize the whole string through UTF-16, as Normalize used to.
+std::string NormalizeReference(const std::string &in) {
+  UErrorCode err = U_ZERO_ERROR;
+  UnicodeString normalized(Normalizer2::getNFKCInstance(err)->normalize(UnicodeString::fromUTF8(in), err));
+  BOOST_REQUIRE(U_SUCCESS(err));
+  std::string ret;
+  normalized.toUTF8String(ret);
+  return ret;
+}
+
+BOOST_AUTO_TEST_CASE(NormalizeFuzz) {
+  // Compatibility characters, combining marks that reorder and compose,
+  // Hangul jamo, and bad bytes.
+  const char *kPieces[] = {"a", "e", "Z", " ", "é", "ﬁ", "⁵", "½", "Ⅻ", "ｶ", "ﾞ", "\xcc\x81", "\xcc\xa3", "\xcc\x82", "\xe1\x84\x80", "\xe1\x85\xa1", "\xe1\x86\xa8", "가", "Å", "\xe2\x84\xab", "ǅ", "\xff", "\xe2\x82", "plain ascii text "};
+  Random rand;
+  for (std::size_t trial = 0; trial < 20000; ++trial) {
+    std::string str;
+    for (std::size_t p = rand(16); p; --p) {
+      str += kPieces[rand(sizeof(kPieces) / sizeof(const char*))];
+    }
+    std::string ref(NormalizeReference(str)), out;
+    Normalize(str, out);
+    if (out != ref) BOOST_FAIL("Normalizing " << Escape(str) << " gave " << Escape(out) << " instead of " << Escape(ref));
+    UnicodeString uni;
+    Normalize(UnicodeString::fromUTF8(str), uni);
+    out.clear();
+    uni.toUTF8String(out);
+    if (out != ref) BOOST_FAIL("Normalizing UTF-16 " << Escape(str) << " gave " << Escape(out) << " instead of " << Escape(ref));
+  }
+}
+
 BOOST_AUTO_TEST_CASE(FlattenEnglish) {
   CHECK_FLATTEN("\"foo bar\" '", "«foo bar» '", "en");
 }
@@ -74,6 +365,69 @@ BOOST_AUTO_TEST_CASE(FlattenPossessive) {
   CHECK_FLATTEN("a's ", "a' s ", "en");
   CHECK_FLATTEN("' sfoo", "' sfoo", "en");
   CHECK_FLATTEN("' sfoo ", "' sfoo ", "en");
+  // Any Unicode space is a boundary, and the space is flattened too.
+  CHECK_FLATTEN("'s ", "' s\u00A0", "en");
+  CHECK_FLATTEN("'s\u3000", "' s\u3000", "en");
+  CHECK_FLATTEN("5 -year-old", "5{ - year - old", "en");
+}
+
+BOOST_AUTO_TEST_CASE(FlattenBytes) {
+  CHECK_FLATTEN("&& amp", "& amp ;& amp", "en");
+  CHECK_FLATTEN("ae--ae", "æ—æ", "fr");
+  // Characters outside the BMP pass through once.
+  CHECK_FLATTEN("a\xf0\x9f\x98\x80...", "a\xf0\x9f\x98\x80…", "en");
+  // Each bad sequence becomes U+FFFD, as converting to UTF-16 did.
+  CHECK_FLATTEN("a\xef\xbf\xbd" "b\xef\xbf\xbd" "c\xef\xbf\xbd", "a\xff" "b\xe2\x82" "c\xf0\x9f\x98", "en");
+}
+
+// The steps one at a time, as process_unicode used to do them.
+std::string Chain(const std::string &in, const CaseMap *lower, const Flatten *flatten, bool normalize) {
+  std::string line, out;
+  UnicodeString::fromUTF8(in).toUTF8String(line);
+  if (lower) {
+    ToLower(line, out, *lower);
+    line.swap(out);
+  }
+  if (flatten) {
+    flatten->Apply(line, out);
+    line.swap(out);
+  }
+  if (normalize) {
+    Normalize(line, out);
+    line.swap(out);
+  }
+  return line;
+}
+
+BOOST_AUTO_TEST_CASE(TransformFuzz) {
+  // Rules that span several characters, case, text that composes with the
+  // ASCII before it, and bad bytes.
+  const char *kPieces[] = {"A", "z", "I", " ", "'", "S", "s", "`", "&", " AMP ", "; ", "5", "{", " - YEAR - OLD", "-", "=", "\xcc\xb8", "\xcc\x81", "\xcc\x80", "Σ", "İ", "ß", "«", "’", "…", "ﬁ", "⁵", "\xc2\xa0", "\xff", "\xe2\x82", "Plain ASCII Text "};
+  const char *kLanguages[] = {"en", "fr", "de", "cs"};
+  const char *kLocales[] = {NULL, "lt", "tr"};
+  Random rand;
+  for (std::size_t trial = 0; trial < 20000; ++trial) {
+    std::string str;
+    for (std::size_t p = rand(16); p; --p) {
+      str += kPieces[rand(sizeof(kPieces) / sizeof(const char*))];
+    }
+    // Half the lines are ASCII.
+    if (rand(2)) {
+      for (std::string::iterator i = str.begin(); i != str.end(); ++i) *i &= 0x7F;
+    }
+    const char *locale = kLocales[rand(sizeof(kLocales) / sizeof(const char*))];
+    Flatten flatten(kLanguages[rand(sizeof(kLanguages) / sizeof(const char*))]);
+    const CaseMap *lower = rand(2) ? &ThreadCaseMap(locale) : NULL;
+    const Flatten *flattening = rand(2) ? &flatten : NULL;
+    bool normalize = rand(2);
+    Transform transform(lower, flattening, normalize);
+    std::string ref(Chain(str, lower, flattening, normalize)), out;
+    // Twice to reuse the buffers.
+    for (unsigned i = 0; i < 2; ++i) {
+      transform.Apply(str, out);
+      if (out != ref) BOOST_FAIL("Transforming " << Escape(str) << " gave " << Escape(out) << " instead of " << Escape(ref));
+    }
+  }
 }
 
 } // namespace